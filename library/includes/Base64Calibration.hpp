@@ -0,0 +1,63 @@
+#ifndef BASE_64_CALIBRATION_HPP_
+#define BASE_64_CALIBRATION_HPP_
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace Phobos {
+class EncodeService;
+
+// The thresholds picked for this machine, along with what they were picked
+// from. A saved calibration is only loaded back on the same CPU model with the
+// same hardware concurrency.
+struct EncodeCalibration {
+  std::string cpuModel;
+  size_t hardwareConcurrency;
+  // Measured on an input which fits in the L1 cache.
+  size_t encodeBytesPerSecond;
+  // The time it takes to wake a waiting thread.
+  size_t handoffNanoseconds;
+
+  // For EncodeService.
+  size_t inlineThreshold;
+  size_t chunkByteCount;
+  // For SetStreamingThresholdBase64. 0 if the streaming mode was slower.
+  size_t streamingThreshold;
+};
+
+// Micro-benchmarks the encode paths and the thread handoff. It takes about 20
+// to 30 milliseconds in an optimised build, most of it spent encoding a 4MB
+// buffer with and without the streaming stores, so it is meant to be run once
+// and saved with SaveEncodeCalibration. The inline threshold is the size which
+// takes a few handoffs to encode, the chunks take many more, and the streaming
+// threshold is the size of the last level cache if the streaming mode is as
+// fast as the normal one.
+[[nodiscard]]
+EncodeCalibration CalibrateEncode();
+
+// Sets the thresholds of the service and the streaming threshold. The streaming
+// threshold is process-wide, so it changes the mode of every encode, not only
+// the service's. Returns the previous streaming threshold, so it can be put
+// back with SetStreamingThresholdBase64.
+size_t ApplyEncodeCalibration(const EncodeCalibration &calibration,
+                              EncodeService &service) noexcept;
+
+// The file is a few "key=value" lines. Returns nullopt if the file can't be
+// read, is malformed or was made on a different machine.
+[[nodiscard]]
+std::optional<EncodeCalibration>
+LoadEncodeCalibration(const std::filesystem::path &filePath);
+bool SaveEncodeCalibration(const std::filesystem::path &filePath,
+                           const EncodeCalibration &calibration);
+
+// Loads the calibration from the file, or calibrates and saves it there if it
+// can't be loaded.
+[[nodiscard]]
+EncodeCalibration LoadOrCalibrateEncode(const std::filesystem::path &filePath);
+
+// The model name from /proc/cpuinfo on Linux, "unknown" elsewhere.
+[[nodiscard]]
+std::string GetCpuModelName();
+} // namespace Phobos
+#endif
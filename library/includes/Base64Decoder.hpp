@@ -0,0 +1,179 @@
+#ifndef BASE_64_DECODER_HPP_
+#define BASE_64_DECODER_HPP_
+#include <Base64Encoder.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Phobos {
+inline constexpr std::uint8_t invalidValueBase64 = 0xFFU;
+inline constexpr size_t decodeMapSizeBase64 =
+  static_cast<size_t>(std::numeric_limits<unsigned char>::max()) + 1U;
+
+// Builds the reverse lookup table of an alphabet, any character which isn't in
+// the alphabet maps to invalidValueBase64.
+template <size_t characterCount>
+[[nodiscard]]
+consteval std::array<std::uint8_t, decodeMapSizeBase64>
+MakeDecodeMapBase64(const std::array<char, characterCount> &characterMap) {
+  std::array<std::uint8_t, decodeMapSizeBase64> decodeMap{};
+
+  decodeMap.fill(invalidValueBase64);
+
+  for (size_t index = 0U; index < characterCount; ++index) {
+    decodeMap.at(static_cast<unsigned char>(characterMap.at(index))) =
+      static_cast<std::uint8_t>(index);
+  }
+
+  return decodeMap;
+}
+
+inline constexpr std::array decodeMapBase64{
+  MakeDecodeMapBase64(characterMapBase64)};
+inline constexpr std::array decodeMapBase64Url{
+  MakeDecodeMapBase64(characterMapBase64Url)};
+
+namespace Detail {
+// The largest value of a character in the alphabet, anything above it is an
+// invalid character.
+inline constexpr std::uint8_t maxValidValueBase64 = 63U;
+
+// Decodes 4 characters into 3 bytes. The characters after validCharCount are
+// padding and are decoded as 0. Returns false if any of the valid characters
+// isn't in the alphabet.
+[[nodiscard]]
+inline bool
+DecodeUnit(char const *encodedUnit, size_t validCharCount,
+           std::array<std::uint8_t, byteCountBase64> &decodedUnit) noexcept {
+  std::uint32_t decodedValue = 0U;
+  std::uint8_t accumulatedValue = 0U;
+
+  for (size_t index = 0U; index < charCountBase64; ++index) {
+    std::uint8_t value = 0U;
+
+    if (index < validCharCount) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto character = static_cast<unsigned char>(encodedUnit[index]);
+
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      value = decodeMapBase64[character];
+    }
+
+    accumulatedValue |= value;
+
+    decodedValue = (decodedValue << bitCountCharBase64) | value;
+  }
+
+  decodedUnit[0] = static_cast<std::uint8_t>(decodedValue >> 16U);
+  decodedUnit[1] = static_cast<std::uint8_t>(decodedValue >> bitsInByte);
+  decodedUnit[2] = static_cast<std::uint8_t>(decodedValue);
+
+  return accumulatedValue <= maxValidValueBase64;
+}
+
+// Decodes the whitespace free 4 characters at the front, without any checks
+// per character. Returns false if any of them isn't in the alphabet, which
+// includes the whitespace and the padding.
+[[nodiscard]]
+inline bool DecodeFullUnit(char const *encodedUnit,
+                           std::uint8_t *decodedData) noexcept {
+  // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+  const std::uint8_t value0 =
+    decodeMapBase64[static_cast<unsigned char>(encodedUnit[0])];
+  const std::uint8_t value1 =
+    decodeMapBase64[static_cast<unsigned char>(encodedUnit[1])];
+  const std::uint8_t value2 =
+    decodeMapBase64[static_cast<unsigned char>(encodedUnit[2])];
+  const std::uint8_t value3 =
+    decodeMapBase64[static_cast<unsigned char>(encodedUnit[3])];
+
+  if ((value0 | value1 | value2 | value3) > maxValidValueBase64) {
+    return false;
+  }
+
+  const std::uint32_t decodedValue =
+    (static_cast<std::uint32_t>(value0) << 18U) |
+    (static_cast<std::uint32_t>(value1) << 12U) |
+    (static_cast<std::uint32_t>(value2) << bitCountCharBase64) | value3;
+
+  decodedData[0] = static_cast<std::uint8_t>(decodedValue >> 16U);
+  decodedData[1] = static_cast<std::uint8_t>(decodedValue >> bitsInByte);
+  decodedData[2] = static_cast<std::uint8_t>(decodedValue);
+  // NOLINTEND(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+
+  return true;
+}
+} // namespace Detail
+
+// Only checks the alphabet, the padding placement and the length. Doesn't
+// allocate or decode anything. The input must be padded to a multiple of 4
+// characters, the same way EncodeBase64 outputs it.
+[[nodiscard]]
+bool IsValidBase64(std::string_view encodedData) noexcept;
+
+// Same as IsValidBase64 but for the url-safe alphabet. The padding is optional
+// here, as it is usually dropped from urls.
+[[nodiscard]]
+bool IsValidBase64Url(std::string_view encodedData) noexcept;
+
+// Returns the number of bytes the padded encoded data would decode to. Returns
+// 0 if the length isn't a multiple of 4.
+[[nodiscard]]
+size_t DecodedByteCountBase64(std::string_view encodedData) noexcept;
+
+// Decodes only the units which cover the elements [elementOffset,
+// elementOffset + elementCount). Elements larger than a byte are converted back
+// from big endian, the same way EncodeBase64 writes them, so the output can be
+// used as an array of the primitive. Returns nullopt if the range is out of
+// bounds, the primitive size is unsupported or a covering unit is invalid.
+[[nodiscard]]
+std::optional<std::vector<std::uint8_t>>
+DecodeBase64Range(std::string_view encodedData, size_t elementOffset,
+                  size_t elementCount, size_t primitiveSize = 1U) noexcept;
+
+// Returns nullopt if the encoded data is invalid, including a length which
+// isn't a multiple of 4, the primitive size is unsupported or the decoded bytes
+// aren't whole elements.
+[[nodiscard]]
+std::optional<std::vector<std::uint8_t>>
+DecodeBase64(std::string_view encodedData, size_t primitiveSize = 1U) noexcept;
+
+// Decodes into the caller's elements. The byte order is the one the elements
+// were encoded in, they are reordered to native while the units are unpacked.
+// Returns false if the encoded data is invalid, the primitive size is
+// unsupported or it doesn't decode to exactly elementCount elements. The
+// elements might be partially written if it fails.
+[[nodiscard]]
+bool DecodeBase64(std::string_view encodedData, void *dataHandle,
+                  size_t elementCount, size_t primitiveSize,
+                  std::endian byteOrder = std::endian::big) noexcept;
+
+template <std::endian byteOrder = std::endian::big, Base64Element_t T,
+          size_t extent>
+[[nodiscard]]
+bool DecodeBase64(std::string_view encodedData,
+                  std::span<T, extent> decodedData) noexcept {
+  return DecodeBase64(encodedData, std::data(decodedData),
+                      std::size(decodedData), sizeof(T), byteOrder);
+}
+
+// Same as DecodeBase64 but skips spaces, tabs, line breaks and form feeds
+// anywhere in the input, so wrapped MIME or PEM text and indented JSON strings
+// can be decoded without stripping them first. The characters which are left
+// must be a valid padded encoding. Returns the decoded byte count, or nullopt
+// if the input is invalid or decodedData is too small.
+[[nodiscard]]
+std::optional<size_t>
+DecodeBase64Lenient(std::string_view encodedData,
+                    std::span<std::uint8_t> decodedData) noexcept;
+[[nodiscard]]
+std::optional<std::vector<std::uint8_t>>
+DecodeBase64Lenient(std::string_view encodedData) noexcept;
+} // namespace Phobos
+#endif
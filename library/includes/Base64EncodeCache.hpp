@@ -0,0 +1,102 @@
+#ifndef BASE_64_ENCODE_CACHE_HPP_
+#define BASE_64_ENCODE_CACHE_HPP_
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Phobos {
+struct EncodeCacheStats {
+  size_t hitCount;
+  size_t missCount;
+  size_t evictionCount;
+  size_t entryCount;
+  // The encoded strings and the source copies of the entries.
+  size_t byteCount;
+};
+
+// Keeps the encoded strings of recently encoded payloads, so encoding the same
+// payload again costs a hash instead of an encode. Entries are keyed by a hash
+// of the content plus the byte count, the primitive size and the byte order,
+// and a hit is only taken if the stored source matches, so a hash collision is
+// a miss. The least recently used entries are evicted to stay within the byte
+// budget. A full copy of each source is kept and compared on every hit, and the
+// budget counts it along with the encoded string, so an entry costs about 2.33
+// times its payload. All of the member functions are thread safe.
+class EncodeCache {
+public:
+  using Encoded_t = std::shared_ptr<const std::string>;
+
+  // The budget is for the source copies and the encoded strings together.
+  explicit EncodeCache(size_t byteBudget);
+
+  // Payloads which don't fit in the budget are encoded but not cached. Invalid
+  // elements, see AreElementsValidBase64, return an empty string which isn't
+  // cached or counted.
+  [[nodiscard]]
+  Encoded_t EncodeBase64Str(void const *dataHandle, size_t elementCount,
+                            size_t primitiveSize,
+                            std::endian byteOrder = std::endian::big);
+
+  // Evicts entries if the new budget is smaller.
+  void SetByteBudget(size_t byteBudget);
+  void Clear() noexcept;
+
+  [[nodiscard]]
+  EncodeCacheStats GetStats() const noexcept;
+
+private:
+  struct Key {
+    std::uint64_t hash;
+    size_t byteCount;
+    size_t primitiveSize;
+    std::endian byteOrder;
+
+    bool operator==(const Key &) const noexcept = default;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key &key) const noexcept {
+      return static_cast<size_t>(key.hash);
+    }
+  };
+
+  struct Entry {
+    Key key;
+    std::vector<std::uint8_t> sourceData;
+    Encoded_t encodedData;
+  };
+
+  using EntryList_t = std::list<Entry>;
+
+  void EvictTo_(size_t byteBudget) noexcept;
+
+  [[nodiscard]]
+  static size_t GetEntryByteCount_(const Entry &entry) noexcept {
+    return std::size(entry.sourceData) + std::size(*entry.encodedData);
+  }
+
+private:
+  mutable std::mutex m_mutex;
+  // The most recently used entry is at the front.
+  EntryList_t m_entries;
+  std::unordered_map<Key, EntryList_t::iterator, KeyHash> m_entryMap;
+  size_t m_byteBudget;
+  size_t m_byteCount;
+  size_t m_hitCount;
+  size_t m_missCount;
+  size_t m_evictionCount;
+};
+
+// 64bits hash of the bytes, it reads 8 bytes at a time and isn't meant to be
+// cryptographic.
+[[nodiscard]]
+std::uint64_t HashBytesBase64(void const *dataHandle,
+                              size_t byteCount) noexcept;
+} // namespace Phobos
+#endif
@@ -0,0 +1,66 @@
+#ifndef BASE_64_ENCODE_JOB_HPP_
+#define BASE_64_ENCODE_JOB_HPP_
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Phobos {
+struct EncodeJobProgress {
+  // The input bytes and the output characters which are done so far.
+  size_t byteCount;
+  size_t charCount;
+  bool isComplete;
+};
+
+// Encodes a payload a slice at a time, so a single threaded event loop can
+// interleave it with its other work and bound the stall of each step. Every
+// slice is a multiple of LCM(3, primitiveSize) bytes, except the last one, so
+// the slices encode into whole units and the output is the same as a single
+// EncodeBase64. The input and the output must stay alive until the job is
+// complete.
+class EncodeJob {
+public:
+  // The output must have at least EncodedCharCountBase64 characters. An invalid
+  // job is complete from the start, without encoding anything.
+  EncodeJob(void const *dataHandle, size_t elementCount, size_t primitiveSize,
+            std::span<char> encodedData,
+            std::endian byteOrder = std::endian::big) noexcept;
+
+  // False if the elements are invalid or the output is too small.
+  [[nodiscard]]
+  bool IsValid() const noexcept {
+    return m_isValid;
+  }
+  [[nodiscard]]
+  bool IsComplete() const noexcept {
+    return m_byteIndex == m_byteCount;
+  }
+
+  // Encodes about byteBudget bytes, rounded down to the slices. At least one
+  // slice is encoded, so every step makes progress.
+  EncodeJobProgress Step(size_t byteBudget) noexcept;
+  // Encodes small slices until the budget is used up. The last slice can go
+  // over the budget by the time of a slice, which is a few microseconds.
+  EncodeJobProgress Step(std::chrono::nanoseconds timeBudget) noexcept;
+
+  [[nodiscard]]
+  EncodeJobProgress GetProgress() const noexcept;
+
+private:
+  void EncodeSlice_(size_t sliceByteCount) noexcept;
+
+private:
+  std::uint8_t const *m_dataHandle;
+  size_t m_primitiveSize;
+  std::span<char> m_encodedData;
+  std::endian m_byteOrder;
+  size_t m_byteCount;
+  size_t m_blockByteCount;
+  size_t m_byteIndex;
+  size_t m_charIndex;
+  bool m_isValid;
+};
+} // namespace Phobos
+#endif
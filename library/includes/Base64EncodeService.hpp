@@ -0,0 +1,143 @@
+#ifndef BASE_64_ENCODE_SERVICE_HPP_
+#define BASE_64_ENCODE_SERVICE_HPP_
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Phobos {
+struct EncodeServiceSettings {
+  // 0 uses the hardware concurrency.
+  size_t workerCount = 0U;
+  // Jobs with fewer bytes are encoded on the caller thread, as the handoff
+  // would cost more than the encode.
+  size_t inlineThreshold = 64U * 1024U;
+  // Large jobs are split into chunks of this many bytes. It is rounded down to
+  // a multiple of LCM(3, primitiveSize), so every chunk encodes into whole
+  // units.
+  size_t chunkByteCount = 256U * 1024U;
+};
+
+struct EncodeServiceStats {
+  // The chunks which are waiting in the worker deques.
+  size_t queueDepth;
+  size_t submittedJobCount;
+  size_t inlineJobCount;
+  size_t completedJobCount;
+  size_t stolenChunkCount;
+  // From the submission to the completion of the jobs which went through the
+  // workers.
+  std::chrono::nanoseconds averageLatency;
+  std::chrono::nanoseconds maxLatency;
+};
+
+// Encodes jobs from many threads on a work-stealing pool. Every worker has its
+// own deque, it pops from the back of its own and steals from the front of the
+// others. The data must stay alive until the job is complete.
+class EncodeService {
+public:
+  using Callback_t = std::function<void(std::string)>;
+
+  explicit EncodeService(EncodeServiceSettings settings = {});
+  ~EncodeService() noexcept;
+
+  EncodeService(const EncodeService &) = delete;
+  EncodeService &operator=(const EncodeService &) = delete;
+  EncodeService(EncodeService &&) = delete;
+  EncodeService &operator=(EncodeService &&) = delete;
+
+  // The process-wide service, it is created on the first call.
+  [[nodiscard]]
+  static EncodeService &Get();
+
+  [[nodiscard]]
+  std::future<std::string>
+  Submit(void const *dataHandle, size_t elementCount, size_t primitiveSize,
+         std::endian byteOrder = std::endian::big);
+  // The callback is called on the thread which completes the job, which is the
+  // caller thread for the inline jobs.
+  void Submit(void const *dataHandle, size_t elementCount, size_t primitiveSize,
+              Callback_t callback, std::endian byteOrder = std::endian::big);
+
+  void SetInlineThreshold(size_t inlineThreshold) noexcept {
+    m_inlineThreshold.store(inlineThreshold, std::memory_order_relaxed);
+  }
+  void SetChunkByteCount(size_t chunkByteCount) noexcept {
+    m_chunkByteCount.store(chunkByteCount, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]]
+  size_t GetInlineThreshold() const noexcept {
+    return m_inlineThreshold.load(std::memory_order_relaxed);
+  }
+  [[nodiscard]]
+  size_t GetChunkByteCount() const noexcept {
+    return m_chunkByteCount.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]]
+  size_t GetWorkerCount() const noexcept {
+    return std::size(m_workers);
+  }
+
+  [[nodiscard]]
+  EncodeServiceStats GetStats() const noexcept;
+
+private:
+  struct Job;
+
+  struct Chunk {
+    std::shared_ptr<Job> job;
+    void const *dataHandle;
+    size_t elementCount;
+    size_t primitiveSize;
+    std::endian byteOrder;
+    size_t charOffset;
+  };
+
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Chunk> chunks;
+  };
+
+  void Enqueue_(std::shared_ptr<Job> job, void const *dataHandle,
+                size_t elementCount, size_t primitiveSize,
+                std::endian byteOrder);
+  void Run_(size_t workerIndex) noexcept;
+  [[nodiscard]]
+  bool PopChunk_(size_t workerIndex, Chunk &chunk) noexcept;
+  void ProcessChunk_(const Chunk &chunk) noexcept;
+  void CompleteJob_(Job &job) noexcept;
+
+private:
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::vector<std::thread> m_threads;
+
+  std::mutex m_waitMutex;
+  std::condition_variable m_waitCondition;
+  bool m_isStopping;
+
+  std::atomic<size_t> m_inlineThreshold;
+  std::atomic<size_t> m_chunkByteCount;
+  std::atomic<size_t> m_nextWorker;
+
+  std::atomic<size_t> m_queueDepth;
+  std::atomic<size_t> m_submittedJobCount;
+  std::atomic<size_t> m_inlineJobCount;
+  std::atomic<size_t> m_completedJobCount;
+  std::atomic<size_t> m_stolenChunkCount;
+  std::atomic<std::uint64_t> m_totalLatencyNs;
+  std::atomic<std::uint64_t> m_maxLatencyNs;
+};
+} // namespace Phobos
+#endif
@@ -0,0 +1,70 @@
+#ifndef BASE_64_ENCODED_VIEW_HPP_
+#define BASE_64_ENCODED_VIEW_HPP_
+#include <Base64Encoder.hpp>
+#include <bit>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Phobos {
+// Keeps the encoded text of a source buffer and only re-encodes the blocks
+// which were changed. A block is LCM(3, primitiveSize) bytes, which is the
+// smallest unit of elements that encodes into full units, so 3 bytes for
+// bytes, 6 for 16bits, 12 for 32bits and 24 for 64bits. The source buffer isn't
+// owned and must outlive the view. The byte order is the one the elements are
+// encoded in, same as EncodeBase64.
+class Base64EncodedView {
+public:
+  Base64EncodedView(void *dataHandle, size_t elementCount, size_t primitiveSize,
+                    std::endian byteOrder = std::endian::big);
+
+  // Copies the bytes into the source buffer and marks them dirty. Returns false
+  // and doesn't write anything if the range is out of bounds.
+  bool Write(size_t byteOffset, void const *data, size_t byteCount);
+  // For changes which were made to the source buffer directly. The range is
+  // clamped to the source buffer and merged with the dirty ranges it overlaps
+  // or touches, so there are never more dirty ranges than half the blocks.
+  void MarkDirty(size_t byteOffset, size_t byteCount);
+
+  // Re-encodes the dirty blocks.
+  void Flush() noexcept;
+
+  [[nodiscard]]
+  bool IsDirty() const noexcept {
+    return !std::empty(m_dirtyBlocks);
+  }
+
+  // The text is only updated on Flush.
+  [[nodiscard]]
+  std::string_view GetText() const noexcept {
+    return m_encodedData;
+  }
+
+  [[nodiscard]]
+  size_t GetBlockByteCount() const noexcept {
+    return m_blockByteCount;
+  }
+  [[nodiscard]]
+  size_t GetDirtyRangeCount() const noexcept {
+    return std::size(m_dirtyBlocks);
+  }
+
+private:
+  void EncodeBlocks_(size_t firstBlock, size_t lastBlock) noexcept;
+
+private:
+  void *m_dataHandle;
+  size_t m_elementCount;
+  size_t m_primitiveSize;
+  std::endian m_byteOrder;
+  size_t m_byteCount;
+  size_t m_blockByteCount;
+  std::string m_encodedData;
+  // [first, last) block ranges, sorted and without any overlapping or adjacent
+  // ones.
+  std::vector<std::pair<size_t, size_t>> m_dirtyBlocks;
+};
+} // namespace Phobos
+#endif
@@ -1,12 +1,19 @@
 #ifndef BASE_64_ENCODER_HPP_
 #define BASE_64_ENCODER_HPP_
+#include <algorithm>
 #include <array>
 #include <bit>
 #include <bitset>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <ranges>
+#include <span>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace Phobos {
@@ -15,6 +22,24 @@ inline constexpr size_t charCountBase64 = 4U;
 inline constexpr size_t bitCountCharBase64 = 6U;
 inline constexpr size_t bitCountBase64 = 24U; // 6 x 4 = 24bits.
 inline constexpr size_t byteCountBase64 = 3U;
+inline constexpr char paddingCharBase64 = '=';
+
+// The alphabets are shared by the encoders, the decoders and the validators,
+// so they can't drift apart.
+inline constexpr std::array characterMapBase64{
+  'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
+  'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
+  'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
+  'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
+  '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'};
+
+// RFC 4648 section 5, only the last two characters differ.
+inline constexpr std::array characterMapBase64Url{
+  'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
+  'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
+  'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
+  'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
+  '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '-', '_'};
 
 class Encoder24Bits {
 public:
@@ -246,12 +271,676 @@ private:
   std::array<Encoder24Bits, unitCount> LoadEncoder48bits() const noexcept;
 };
 
+#ifdef __SIZEOF_INT128__
+// GCC and Clang have the 128bits integers as an extension, which the type
+// traits don't count as integral in the strict modes.
+// NOLINTBEGIN(modernize-use-using)
+__extension__ typedef __int128 Int128Base64_t;
+__extension__ typedef unsigned __int128 UInt128Base64_t;
+// NOLINTEND(modernize-use-using)
+
+template <typename T>
+inline constexpr bool isInt128Base64 =
+  std::is_same_v<T, Int128Base64_t> || std::is_same_v<T, UInt128Base64_t>;
+#else
+template <typename T>
+inline constexpr bool isInt128Base64 = false;
+#endif
+
+// Any integral, floating point, enum or std::byte type with 1, 2, 4 or 8 bytes
+// and the 128bits integers. The wider ones are encoded in big endian, same as
+// the void const* overloads.
+template <typename T>
+concept Base64Element_t =
+  ((std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+    std::is_same_v<T, std::byte>) &&
+   (sizeof(T) == 1U || sizeof(T) == 2U || sizeof(T) == 4U ||
+    sizeof(T) == 8U)) ||
+  isInt128Base64<T>;
+
+// The character types the encoded output can be written in. The alphabet is
+// ASCII, so every one of them holds it as is.
+template <typename T>
+concept Base64Char_t = std::is_same_v<T, char> || std::is_same_v<T, char8_t> ||
+                       std::is_same_v<T, char16_t>;
+
+namespace Detail {
+inline constexpr std::uint32_t lower6BitsMask = 0x3FU;
+
+// The alphabet widened to the output character type, so the lookup stores the
+// wide character directly.
+template <Base64Char_t Char_t>
+inline constexpr auto characterMap = [] {
+  std::array<Char_t, std::size(characterMapBase64)> wideCharacterMap{};
+
+  for (size_t index = 0U; index < std::size(characterMapBase64); ++index) {
+    wideCharacterMap.at(index) =
+      static_cast<Char_t>(characterMapBase64.at(index));
+  }
+
+  return wideCharacterMap;
+}();
+
+// Encodes the 24bits of the value into 4 characters with fixed shifts.
+template <Base64Char_t Char_t = char>
+inline void EncodeUnit(std::uint32_t value, Char_t *encodedData) noexcept {
+  const auto &wideCharacterMap = characterMap<Char_t>;
+
+  // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+  encodedData[0] = wideCharacterMap[(value >> 18U) & lower6BitsMask];
+  encodedData[1] = wideCharacterMap[(value >> 12U) & lower6BitsMask];
+  encodedData[2] = wideCharacterMap[(value >> 6U) & lower6BitsMask];
+  encodedData[3] = wideCharacterMap[value & lower6BitsMask];
+  // NOLINTEND(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+}
+
+// Loads 3 bytes as a 24bits big endian value.
+[[nodiscard]]
+inline std::uint32_t LoadUnit(std::uint8_t const *data) noexcept {
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  return static_cast<std::uint32_t>(data[0]) << 16U |
+         static_cast<std::uint32_t>(data[1]) << bitsInByte |
+         static_cast<std::uint32_t>(data[2]);
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+// Encodes the last 1 or 2 bytes with padding, does nothing for 0.
+template <Base64Char_t Char_t = char>
+inline void EncodeTail(std::uint8_t const *data, size_t remainingByteCount,
+                       Char_t *encodedData) noexcept {
+  if (remainingByteCount == 0U) {
+    return;
+  }
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  std::uint32_t value = static_cast<std::uint32_t>(data[0]) << 16U;
+
+  if (remainingByteCount == 2U) {
+    value |= static_cast<std::uint32_t>(data[1]) << bitsInByte;
+  }
+
+  EncodeUnit(value, encodedData);
+
+  // 1 byte only fills 2 characters and 2 bytes 3 characters, the rest are
+  // padding.
+  encodedData[3] = static_cast<Char_t>(paddingCharBase64);
+
+  if (remainingByteCount == 1U) {
+    encodedData[2] = static_cast<Char_t>(paddingCharBase64);
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+// The bulk loop works on blocks of 8 units, 24 bytes into 32 characters.
+inline constexpr size_t unitCountPerBlock = 8U;
+inline constexpr size_t byteCountPerBlock = byteCountBase64 * unitCountPerBlock;
+inline constexpr size_t charCountPerBlock = charCountBase64 * unitCountPerBlock;
+
+inline constexpr size_t wordCountPerBlock =
+  byteCountPerBlock / sizeof(std::uint64_t);
+
+using Block_t = std::array<std::uint64_t, wordCountPerBlock>;
+
+template <Base64Char_t Char_t = char>
+inline void EncodeBytes(void const *dataHandle, size_t byteCount,
+                        Char_t *encodedData) noexcept {
+  auto const *dataHandleU8 = static_cast<std::uint8_t const *>(dataHandle);
+
+  size_t eIndex = 0U;
+  size_t cIndex = 0U;
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  if (byteCount >= byteCountPerBlock) {
+    Block_t previousBlock{};
+
+    // The characters of the first block of the current run. Copying from it
+    // instead of the previous block keeps the copies independent of each other.
+    size_t runCIndex = 0U;
+
+    for (; eIndex + byteCountPerBlock <= byteCount;
+         eIndex += byteCountPerBlock) {
+      Block_t block{};
+
+      memcpy(std::data(block), dataHandleU8 + eIndex, byteCountPerBlock);
+
+      // Runs of zeroes, or of any pattern which repeats every 24 bytes, make
+      // the block the same as the previous one, so its characters can be
+      // copied instead. Dense data only pays for the word compares.
+      const bool isRepeated = eIndex != 0U && ((block[0] ^ previousBlock[0]) |
+                                               (block[1] ^ previousBlock[1]) |
+                                               (block[2] ^ previousBlock[2])) ==
+                                                0U;
+
+      if (isRepeated) {
+        memcpy(encodedData + cIndex, encodedData + runCIndex,
+               charCountPerBlock * sizeof(Char_t));
+      } else {
+        for (size_t unitIndex = 0U; unitIndex < unitCountPerBlock;
+             ++unitIndex) {
+          EncodeUnit(
+            LoadUnit(dataHandleU8 + eIndex + unitIndex * byteCountBase64),
+            encodedData + cIndex + unitIndex * charCountBase64);
+        }
+
+        runCIndex = cIndex;
+      }
+
+      previousBlock = block;
+      cIndex += charCountPerBlock;
+    }
+  }
+
+  for (; eIndex + byteCountBase64 <= byteCount; eIndex += byteCountBase64) {
+    EncodeUnit(LoadUnit(dataHandleU8 + eIndex), encodedData + cIndex);
+
+    cIndex += charCountBase64;
+  }
+
+  EncodeTail(dataHandleU8 + eIndex, byteCount - eIndex, encodedData + cIndex);
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+template <size_t primitiveSize>
+using UnsignedOf_t = std::conditional_t<
+  primitiveSize == 2U, std::uint16_t,
+  std::conditional_t<primitiveSize == 4U, std::uint32_t, std::uint64_t>>;
+
+// Picks the 24bits of a unit out of a block of 3 elements, which are read as
+// one big endian bit stream. A unit either sits inside an element or spans
+// across the end of one and the start of the next, which is known at compile
+// time, so it is a fixed pair of shifts.
+template <size_t unitIndex, typename Unsigned_t>
+[[nodiscard]]
+inline std::uint32_t
+ExtractUnit(const std::array<Unsigned_t, byteCountBase64> &values) noexcept {
+  constexpr size_t elementBitCount = sizeof(Unsigned_t) * bitsInByte;
+  constexpr size_t bitBegin = unitIndex * bitCountBase64;
+  constexpr size_t firstIndex = bitBegin / elementBitCount;
+  constexpr size_t lastIndex = (bitBegin + bitCountBase64 - 1U) /
+                               elementBitCount;
+  constexpr size_t bitOffset = bitBegin % elementBitCount;
+  constexpr std::uint64_t unitMask = (1LLU << bitCountBase64) - 1U;
+
+  const auto firstValue = static_cast<std::uint64_t>(values[firstIndex]);
+
+  if constexpr (firstIndex == lastIndex) {
+    return static_cast<std::uint32_t>(
+      (firstValue >> (elementBitCount - bitOffset - bitCountBase64)) &
+      unitMask);
+  } else {
+    constexpr size_t highBitCount = elementBitCount - bitOffset;
+    constexpr size_t lowBitCount = bitCountBase64 - highBitCount;
+    constexpr std::uint64_t highMask = (1LLU << highBitCount) - 1U;
+
+    const auto lastValue = static_cast<std::uint64_t>(values[lastIndex]);
+
+    return static_cast<std::uint32_t>(
+      ((firstValue & highMask) << lowBitCount) |
+      (lastValue >> (elementBitCount - lowBitCount)));
+  }
+}
+
+template <typename Unsigned_t, Base64Char_t Char_t, size_t... unitIndices>
+inline void
+EncodeBlockUnits(const std::array<Unsigned_t, byteCountBase64> &values,
+                 Char_t *encodedData,
+                 std::index_sequence<unitIndices...>) noexcept {
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  (EncodeUnit(ExtractUnit<unitIndices>(values),
+              encodedData + unitIndices * charCountBase64),
+   ...);
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+// Encodes 2, 4 or 8 bytes elements in the byte order which isn't native. A
+// block is 3 elements, which is LCM(3, primitiveSize) bytes, so 3 16bits
+// elements are 8 characters, 3 32bits ones 16 and 3 64bits ones 32. The
+// elements are loaded as integers, in big endian order the value already is
+// the bit stream and in little endian it is byteswapped, and the units are cut
+// out with fixed shifts, so there are no branches per element. The last 1 or 2
+// elements are put in order in a small buffer and go through the byte engine.
+template <size_t primitiveSize, std::endian byteOrder,
+          Base64Char_t Char_t = char>
+void EncodeBlocks(void const *dataHandle, size_t elementCount,
+                  Char_t *encodedData) noexcept {
+  using Unsigned_t = UnsignedOf_t<primitiveSize>;
+
+  constexpr size_t unitCountPerBlock = primitiveSize;
+  constexpr size_t charCountPerBlock = unitCountPerBlock * charCountBase64;
+
+  auto const *dataHandleU8 = static_cast<std::uint8_t const *>(dataHandle);
+
+  std::array<Unsigned_t, byteCountBase64> values{};
+
+  size_t eIndex = 0U;
+  size_t cIndex = 0U;
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (; eIndex + byteCountBase64 <= elementCount;
+       eIndex += byteCountBase64) {
+    memcpy(std::data(values), dataHandleU8 + eIndex * primitiveSize,
+           sizeof(values));
+
+    if constexpr (byteOrder == std::endian::little) {
+      for (Unsigned_t &value : values) {
+        value = std::byteswap(value);
+      }
+    }
+
+    EncodeBlockUnits(values, encodedData + cIndex,
+                     std::make_index_sequence<unitCountPerBlock>{});
+
+    cIndex += charCountPerBlock;
+  }
+
+  const size_t remainingElementCount = elementCount - eIndex;
+
+  if (remainingElementCount != 0U) {
+    memcpy(std::data(values), dataHandleU8 + eIndex * primitiveSize,
+           remainingElementCount * primitiveSize);
+
+    // The values are stored back in the big endian byte order.
+    for (Unsigned_t &value : values) {
+      if constexpr ((byteOrder == std::endian::big) !=
+                    (std::endian::native == std::endian::big)) {
+        value = std::byteswap(value);
+      }
+    }
+
+    EncodeBytes(std::data(values), remainingElementCount * primitiveSize,
+                encodedData + cIndex);
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+// Reverses the bytes of an element in place. The power of 2 sizes are loaded
+// as integers and swapped with a single instruction, a 16 bytes one is 2
+// 64bits swaps with the halves exchanged.
+template <size_t primitiveSize>
+inline void SwapElement(std::uint8_t *elementData) noexcept {
+  if constexpr (primitiveSize == 2U || primitiveSize == 4U ||
+                primitiveSize == 8U) {
+    using Unsigned_t = std::conditional_t<
+      primitiveSize == 2U, std::uint16_t,
+      std::conditional_t<primitiveSize == 4U, std::uint32_t, std::uint64_t>>;
+
+    Unsigned_t value{};
+
+    memcpy(&value, elementData, primitiveSize);
+
+    value = std::byteswap(value);
+
+    memcpy(elementData, &value, primitiveSize);
+  } else if constexpr (primitiveSize == 16U) {
+    std::array<std::uint64_t, 2U> halves{};
+
+    memcpy(std::data(halves), elementData, primitiveSize);
+
+    const std::array<std::uint64_t, 2U> swappedHalves{
+      std::byteswap(halves[1]), std::byteswap(halves[0])};
+
+    memcpy(elementData, std::data(swappedHalves), primitiveSize);
+  } else {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::reverse(elementData, elementData + primitiveSize);
+  }
+}
+
+// For the widths without a block kernel, the elements are swapped in a small
+// buffer first. The buffer size is a multiple of 3, so only the last chunk can
+// have padding.
+template <size_t primitiveSize, Base64Char_t Char_t = char>
+void EncodeSwappedElements(void const *dataHandle, size_t elementCount,
+                           Char_t *encodedData) {
+  constexpr size_t chunkElementCount = byteCountBase64 * 64U;
+  constexpr size_t chunkByteCount = chunkElementCount * primitiveSize;
+
+  auto const *dataHandleU8 = static_cast<std::uint8_t const *>(dataHandle);
+
+  const size_t byteCount = elementCount * primitiveSize;
+
+  std::array<std::uint8_t, chunkByteCount> chunk{};
+
+  for (size_t bIndex = 0U; bIndex < byteCount; bIndex += chunkByteCount) {
+    const size_t chunkSize = std::min(chunkByteCount, byteCount - bIndex);
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    memcpy(std::data(chunk), dataHandleU8 + bIndex, chunkSize);
+
+    for (size_t eIndex = 0U; eIndex < chunkSize; eIndex += primitiveSize) {
+      SwapElement<primitiveSize>(std::data(chunk) + eIndex);
+    }
+
+    EncodeBytes(std::data(chunk), chunkSize,
+                encodedData + bIndex / byteCountBase64 * charCountBase64);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+}
+
+// Picks the engine at compile time. The output must have at least
+// EncodedCharCountBase64 characters.
+template <size_t primitiveSize, std::endian byteOrder = std::endian::big,
+          Base64Char_t Char_t = char>
+void EncodeElements(void const *dataHandle, size_t elementCount,
+                    Char_t *encodedData) {
+  if constexpr (primitiveSize == 1U || byteOrder == std::endian::native) {
+    EncodeBytes(dataHandle, elementCount * primitiveSize, encodedData);
+  } else if constexpr (primitiveSize == 16U) {
+    EncodeSwappedElements<primitiveSize>(dataHandle, elementCount,
+                                         encodedData);
+  } else {
+    EncodeBlocks<primitiveSize, byteOrder>(dataHandle, elementCount,
+                                           encodedData);
+  }
+}
+
+// Any other element width, which is only known at runtime. The bytes of each
+// element are gathered from the last to the first straight into the units, so
+// there is no swap buffer.
+template <Base64Char_t Char_t = char>
+void EncodeReversedElements(void const *dataHandle, size_t elementCount,
+                            size_t primitiveSize, Char_t *encodedData) {
+  auto const *dataHandleU8 = static_cast<std::uint8_t const *>(dataHandle);
+
+  std::uint32_t unitValue = 0U;
+  size_t unitByteCount = 0U;
+  size_t cIndex = 0U;
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t eIndex = 0U; eIndex < elementCount; ++eIndex) {
+    std::uint8_t const *elementData = dataHandleU8 + eIndex * primitiveSize;
+
+    for (size_t index = primitiveSize; index > 0U; --index) {
+      unitValue = (unitValue << bitsInByte) | elementData[index - 1U];
+      ++unitByteCount;
+
+      if (unitByteCount == byteCountBase64) {
+        EncodeUnit(unitValue, encodedData + cIndex);
+
+        cIndex += charCountBase64;
+        unitValue = 0U;
+        unitByteCount = 0U;
+      }
+    }
+  }
+
+  if (unitByteCount != 0U) {
+    std::array<std::uint8_t, byteCountBase64> tailData{};
+
+    for (size_t index = unitByteCount; index > 0U; --index) {
+      tailData.at(index - 1U) = static_cast<std::uint8_t>(unitValue);
+      unitValue >>= bitsInByte;
+    }
+
+    EncodeTail(std::data(tailData), unitByteCount, encodedData + cIndex);
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+} // namespace Detail
+
+// The number of characters the encoded output of the elements would take,
+// including the padding.
+[[nodiscard]]
+constexpr size_t EncodedCharCountBase64(size_t elementCount,
+                                        size_t primitiveSize) noexcept {
+  return (elementCount * primitiveSize + 2U) / byteCountBase64 *
+         charCountBase64;
+}
+
+// The byte order is the order the bytes of each element are encoded in. Big
+// endian is the default. With the native order the elements are encoded as raw
+// memory, which goes through the byte engine and skips the byteswaps. An
+// invalid primitive size returns an empty vector.
+[[nodiscard]]
+std::vector<char>
+EncodeBase64(void const *dataHandle, size_t elementCount, size_t primitiveSize,
+             std::endian byteOrder = std::endian::big) noexcept;
+
+// Writes the encoded characters into encodedData instead of allocating. Any
+// primitive size works, 1, 2, 4, 8 and 16 have their own engines and the others
+// are gathered a byte at a time. Returns false if encodedData is smaller than
+// EncodedCharCountBase64, the primitive size is 0 or the byte count overflows.
+[[nodiscard]]
+bool EncodeBase64(void const *dataHandle, size_t elementCount,
+                  size_t primitiveSize, std::span<char> encodedData,
+                  std::endian byteOrder = std::endian::big) noexcept;
+
+// Writes UTF-8 or UTF-16 code units directly, for APIs which take those
+// instead of char, without encoding into a char buffer and widening it after.
+// The output lengths are the same as EncodedCharCountBase64. These never use
+// the streaming mode.
+[[nodiscard]]
+bool EncodeBase64(void const *dataHandle, size_t elementCount,
+                  size_t primitiveSize, std::span<char8_t> encodedData,
+                  std::endian byteOrder = std::endian::big) noexcept;
+[[nodiscard]]
+bool EncodeBase64(void const *dataHandle, size_t elementCount,
+                  size_t primitiveSize, std::span<char16_t> encodedData,
+                  std::endian byteOrder = std::endian::big) noexcept;
+
+// False if the primitive size is 0 or the byte count or the character count
+// would overflow.
+[[nodiscard]]
+bool AreElementsValidBase64(size_t elementCount, size_t primitiveSize) noexcept;
+
+template <typename Allocator_t>
+concept CharAllocator_t = requires(Allocator_t allocator, size_t count) {
+  { allocator.allocate(count) } -> std::same_as<char *>;
+};
+
+// The output is allocated with the caller's allocator, like an arena of a
+// request, instead of the global heap. Nothing else is allocated, the scratch
+// of the swaps and the streaming mode is on the stack. Returns an empty
+// container if the elements are invalid.
+template <CharAllocator_t Allocator_t>
+[[nodiscard]]
+std::vector<char, Allocator_t>
+EncodeBase64(void const *dataHandle, size_t elementCount, size_t primitiveSize,
+             const Allocator_t &allocator,
+             std::endian byteOrder = std::endian::big) {
+  std::vector<char, Allocator_t> encodedData(allocator);
+
+  if (AreElementsValidBase64(elementCount, primitiveSize)) {
+    encodedData.resize(EncodedCharCountBase64(elementCount, primitiveSize));
+
+    [[maybe_unused]] const bool isEncoded =
+      EncodeBase64(dataHandle, elementCount, primitiveSize,
+                   std::span<char>{encodedData}, byteOrder);
+  }
+
+  return encodedData;
+}
+
+template <CharAllocator_t Allocator_t>
+[[nodiscard]]
+std::basic_string<char, std::char_traits<char>, Allocator_t>
+EncodeBase64Str(void const *dataHandle, size_t elementCount,
+                size_t primitiveSize, const Allocator_t &allocator,
+                std::endian byteOrder = std::endian::big) {
+  std::basic_string<char, std::char_traits<char>, Allocator_t> encodedData(
+    allocator);
+
+  if (AreElementsValidBase64(elementCount, primitiveSize)) {
+    encodedData.resize(EncodedCharCountBase64(elementCount, primitiveSize));
+
+    [[maybe_unused]] const bool isEncoded =
+      EncodeBase64(dataHandle, elementCount, primitiveSize,
+                   std::span<char>{encodedData}, byteOrder);
+  }
+
+  return encodedData;
+}
+
+[[nodiscard]]
+std::pmr::vector<char>
+EncodeBase64(void const *dataHandle, size_t elementCount, size_t primitiveSize,
+             std::pmr::memory_resource *memoryResource,
+             std::endian byteOrder = std::endian::big);
+[[nodiscard]]
+std::pmr::string
+EncodeBase64Str(void const *dataHandle, size_t elementCount,
+                size_t primitiveSize, std::pmr::memory_resource *memoryResource,
+                std::endian byteOrder = std::endian::big);
+
+// Inputs of at least this many bytes are encoded in streaming mode. Their
+// output is written with non-temporal stores, which skip the caches, and their
+// input is prefetched ahead, so encoding a huge buffer doesn't evict the rest
+// of the process's working set. The output is meant to be read later, likely
+// by another thread or a write to a file. Targets without SSE2 use normal
+// stores.
+inline constexpr size_t defaultStreamingThresholdBase64 = 32U * 1024U * 1024U;
+
+// 0 turns the streaming mode off. The threshold is process wide.
+void SetStreamingThresholdBase64(size_t byteCount) noexcept;
+[[nodiscard]]
+size_t GetStreamingThresholdBase64() noexcept;
+
+namespace Detail {
+// Same as the span EncodeBase64, but the mode is picked by the caller instead
+// of the threshold. The calibration times both modes with it, without changing
+// the process wide threshold under the other threads.
+[[nodiscard]]
+bool EncodeBase64InMode(void const *dataHandle, size_t elementCount,
+                        size_t primitiveSize, std::span<char> encodedData,
+                        std::endian byteOrder, bool isStreaming) noexcept;
+} // namespace Detail
+
+[[nodiscard]]
+std::string
+EncodeBase64Str(void const *dataHandle, size_t elementCount,
+                size_t primitiveSize,
+                std::endian byteOrder = std::endian::big) noexcept;
+[[nodiscard]]
+std::u8string
+EncodeBase64U8Str(void const *dataHandle, size_t elementCount,
+                  size_t primitiveSize,
+                  std::endian byteOrder = std::endian::big) noexcept;
+[[nodiscard]]
+std::u16string
+EncodeBase64U16Str(void const *dataHandle, size_t elementCount,
+                   size_t primitiveSize,
+                   std::endian byteOrder = std::endian::big) noexcept;
+
+// The byte order is a template parameter here, so it doesn't add a branch.
+template <std::endian byteOrder = std::endian::big, Base64Element_t T>
+[[nodiscard]]
+std::vector<char> EncodeBase64(std::span<T const> data) noexcept {
+  std::vector<char> encodedData(
+    EncodedCharCountBase64(std::size(data), sizeof(T)), '\0');
+
+  Detail::EncodeElements<sizeof(T), byteOrder>(
+    std::data(data), std::size(data), std::data(encodedData));
+
+  return encodedData;
+}
+
+template <std::endian byteOrder = std::endian::big, Base64Element_t T>
+[[nodiscard]]
+std::string EncodeBase64Str(std::span<T const> data) noexcept {
+  std::string encodedData(EncodedCharCountBase64(std::size(data), sizeof(T)),
+                          '\0');
+
+  Detail::EncodeElements<sizeof(T), byteOrder>(
+    std::data(data), std::size(data), std::data(encodedData));
+
+  return encodedData;
+}
+
+template <typename Range_t>
+concept Base64Range_t =
+  std::ranges::contiguous_range<Range_t> &&
+  std::ranges::sized_range<Range_t> &&
+  Base64Element_t<std::ranges::range_value_t<Range_t>>;
+
+template <std::endian byteOrder = std::endian::big, Base64Range_t Range_t>
 [[nodiscard]]
-std::vector<char> EncodeBase64(void const *dataHandle, size_t elementCount,
-                               size_t primitiveSize) noexcept;
+std::vector<char> EncodeBase64(const Range_t &data) noexcept {
+  using Element_t = std::ranges::range_value_t<Range_t>;
+
+  return EncodeBase64<byteOrder>(std::span<Element_t const>{data});
+}
+
+template <std::endian byteOrder = std::endian::big, Base64Range_t Range_t>
+[[nodiscard]]
+std::string EncodeBase64Str(const Range_t &data) noexcept {
+  using Element_t = std::ranges::range_value_t<Range_t>;
+
+  return EncodeBase64Str<byteOrder>(std::span<Element_t const>{data});
+}
+
+namespace Detail {
+template <size_t... unitIndices>
+void EncodeFixedUnits(std::uint8_t const *data, char *encodedData,
+                      std::index_sequence<unitIndices...>) noexcept {
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  (EncodeUnit(LoadUnit(data + unitIndices * byteCountBase64),
+              encodedData + unitIndices * charCountBase64),
+   ...);
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+} // namespace Detail
+
+// For small inputs with a size known at compile time, like 16 byte UUIDs or 32
+// byte digests. The unit loop is unrolled and the result is kept on the stack,
+// so there isn't any allocation or primitive size branching.
+template <size_t byteCount>
+[[nodiscard]]
+std::array<char, EncodedCharCountBase64(byteCount, 1U)>
+EncodeFixed(void const *dataHandle) noexcept {
+  constexpr size_t unitCount = byteCount / byteCountBase64;
+  constexpr size_t remainingByteCount = byteCount % byteCountBase64;
+
+  auto const *dataHandleU8 = static_cast<std::uint8_t const *>(dataHandle);
+
+  std::array<char, EncodedCharCountBase64(byteCount, 1U)> encodedData{};
+
+  Detail::EncodeFixedUnits(dataHandleU8, std::data(encodedData),
+                           std::make_index_sequence<unitCount>{});
+
+  if constexpr (remainingByteCount != 0U) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    Detail::EncodeTail(dataHandleU8 + unitCount * byteCountBase64,
+                       remainingByteCount,
+                       std::data(encodedData) + unitCount * charCountBase64);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  return encodedData;
+}
+
+// The elements are swapped on the stack first if the byte order isn't native.
+template <std::endian byteOrder = std::endian::big, Base64Element_t T,
+          size_t extent>
+  requires(extent != std::dynamic_extent)
+[[nodiscard]]
+std::array<char, EncodedCharCountBase64(extent, sizeof(T))>
+EncodeFixed(std::span<T const, extent> data) noexcept {
+  constexpr size_t byteCount = extent * sizeof(T);
+
+  if constexpr (sizeof(T) == 1U || byteOrder == std::endian::native) {
+    return EncodeFixed<byteCount>(std::data(data));
+  } else {
+    std::array<std::uint8_t, byteCount> swappedData{};
+
+    memcpy(std::data(swappedData), std::data(data), byteCount);
+
+    for (size_t eIndex = 0U; eIndex < byteCount; eIndex += sizeof(T)) {
+      // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::reverse(std::data(swappedData) + eIndex,
+                   std::data(swappedData) + eIndex + sizeof(T));
+      // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    return EncodeFixed<byteCount>(std::data(swappedData));
+  }
+}
 
+template <std::endian byteOrder = std::endian::big, Base64Element_t T,
+          size_t elementCount>
 [[nodiscard]]
-std::string EncodeBase64Str(void const *dataHandle, size_t elementCount,
-                            size_t primitiveSize) noexcept;
+std::array<char, EncodedCharCountBase64(elementCount, sizeof(T))>
+EncodeFixed(const std::array<T, elementCount> &data) noexcept {
+  return EncodeFixed<byteOrder>(std::span<T const, elementCount>{data});
+}
 } // namespace Phobos
 #endif
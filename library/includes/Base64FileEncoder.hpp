@@ -0,0 +1,46 @@
+#ifndef BASE_64_FILE_ENCODER_HPP_
+#define BASE_64_FILE_ENCODER_HPP_
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+
+namespace Phobos {
+struct FileEncodeSettings {
+  // The input bytes per buffer. It is rounded down to a multiple of
+  // LCM(3, primitiveSize), so only the last buffer has padding.
+  size_t bufferByteCount = 1024U * 1024U;
+  // The buffers which are shared by the stages, at least 2. The memory used is
+  // bounded by bufferCount buffers, no matter the file size.
+  size_t bufferCount = 4U;
+  size_t primitiveSize = 1U;
+  std::endian byteOrder = std::endian::big;
+};
+
+struct FileEncodeStats {
+  size_t byteCount;
+  size_t charCount;
+  // The buffers which went through the pipeline.
+  size_t chunkCount;
+  // The time each stage was busy, without the waits for the other stages. If
+  // the stages overlap well, the total time is close to the largest of them.
+  std::chrono::nanoseconds readTime;
+  std::chrono::nanoseconds encodeTime;
+  std::chrono::nanoseconds writeTime;
+  std::chrono::nanoseconds totalTime;
+};
+
+// Encodes the input file into the output file. A reader thread fills the
+// buffers, the calling thread encodes them and a writer thread writes them out,
+// so the reads, the encodes and the writes overlap. Returns nullopt if a file
+// can't be opened, read or written, the settings are invalid or the file size
+// isn't a multiple of the primitive size. The output might be partially
+// written if it fails.
+[[nodiscard]]
+std::optional<FileEncodeStats>
+EncodeFileBase64(const std::filesystem::path &inputPath,
+                 const std::filesystem::path &outputPath,
+                 const FileEncodeSettings &settings = {});
+} // namespace Phobos
+#endif
@@ -0,0 +1,80 @@
+#ifndef BASE_64_RECORD_ENCODER_HPP_
+#define BASE_64_RECORD_ENCODER_HPP_
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Phobos {
+// A field of a record, elementCount elements of primitiveSize bytes at offset.
+// A raw byte field is a primitive size of 1 with the byte count as the element
+// count. Any primitive size works, and the byte order is the one the elements
+// are encoded in, same as EncodeBase64. It can be a constexpr array, as
+// offsetof can fill the offsets.
+struct RecordFieldBase64 {
+  size_t offset;
+  size_t primitiveSize;
+  size_t elementCount = 1U;
+  std::endian byteOrder = std::endian::big;
+};
+
+// Encodes arrays of records as the concatenation of their fields, in the order
+// of the schema, without the padding and the fields which aren't in it. The
+// schema is compiled into a map from each encoded byte to its byte in the
+// record, with the byteswaps folded in, so the records are gathered straight
+// into the 3 byte units and there is no serialised copy of them.
+class RecordEncoder {
+public:
+  RecordEncoder(size_t recordByteCount,
+                std::span<RecordFieldBase64 const> fields);
+
+  // False if a primitive size is 0, a field doesn't fit in the record or there
+  // are no bytes to encode.
+  [[nodiscard]]
+  bool IsValid() const noexcept {
+    return !std::empty(m_byteMap);
+  }
+
+  // The bytes of the fields of a record.
+  [[nodiscard]]
+  size_t GetEncodedByteCount() const noexcept {
+    return std::size(m_byteMap);
+  }
+
+  // 0 if the schema is invalid or the encoded byte count would overflow, the
+  // fields can overlap, so it can be larger than the records.
+  [[nodiscard]]
+  size_t GetEncodedCharCount(size_t recordCount) const noexcept;
+
+  // Returns false if the schema is invalid, the encoded byte count would
+  // overflow or encodedData is smaller than GetEncodedCharCount.
+  [[nodiscard]]
+  bool Encode(void const *recordHandle, size_t recordCount,
+              std::span<char> encodedData) const noexcept;
+  // Returns an empty string if the schema is invalid or the encoded byte count
+  // would overflow.
+  [[nodiscard]]
+  std::string EncodeStr(void const *recordHandle, size_t recordCount) const;
+
+  template <typename Record_t>
+  [[nodiscard]]
+  std::string EncodeStr(std::span<Record_t const> records) const {
+    if (sizeof(Record_t) != m_recordByteCount) {
+      return {};
+    }
+
+    return EncodeStr(std::data(records), std::size(records));
+  }
+
+private:
+  size_t m_recordByteCount;
+  // The record offset of each encoded byte.
+  std::vector<std::uint32_t> m_byteMap;
+  // The fields are the whole record, in order and in native order, so the
+  // records are encoded as raw memory.
+  bool m_isRawRecord;
+};
+} // namespace Phobos
+#endif
@@ -0,0 +1,38 @@
+#ifndef BASE_64_TRANSCODER_HPP_
+#define BASE_64_TRANSCODER_HPP_
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace Phobos {
+// Base64 and hex text are converted into each other a unit at a time, 4
+// characters to 6 hex digits, without decoding into a byte buffer first. The
+// Base64 side uses the same alphabet and padding rules as EncodeBase64.
+
+// Returns 0 if the length isn't a multiple of 4.
+[[nodiscard]]
+size_t HexCharCountFromBase64(std::string_view encodedData) noexcept;
+// Returns 0 if the length isn't a multiple of 2.
+[[nodiscard]]
+size_t Base64CharCountFromHex(std::string_view hexData) noexcept;
+
+// Writes HexCharCountFromBase64 digits into hexData. Returns false if the
+// Base64 text is invalid or hexData is too small.
+[[nodiscard]]
+bool TranscodeBase64ToHex(std::string_view encodedData, std::span<char> hexData,
+                          bool isUpperCase = false) noexcept;
+[[nodiscard]]
+std::optional<std::string> TranscodeBase64ToHex(std::string_view encodedData,
+                                                bool isUpperCase = false);
+
+// Takes both upper and lower case digits. Returns false if there is an odd
+// number of digits, a character isn't a hex digit or encodedData is too small.
+[[nodiscard]]
+bool TranscodeHexToBase64(std::string_view hexData,
+                          std::span<char> encodedData) noexcept;
+[[nodiscard]]
+std::optional<std::string> TranscodeHexToBase64(std::string_view hexData);
+} // namespace Phobos
+#endif
@@ -0,0 +1,314 @@
+#ifndef BASE_64_VIEW_HPP_
+#define BASE_64_VIEW_HPP_
+#include <Base64Encoder.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Phobos {
+// A view of the encoded characters of a buffer, they are computed on demand
+// instead of being stored, so the view can be fed into other views or
+// algorithms without an allocation. The buffer isn't owned and must outlive the
+// view and its iterators, but the iterators don't depend on the view, so the
+// view is a borrowed range. Elements of any width are viewed, a zero primitive
+// size or an element count which overflows makes the view empty.
+class Base64View : public std::ranges::view_interface<Base64View> {
+  // What the characters are computed from. The iterators carry a copy, so they
+  // stay valid when the view is moved or destroyed.
+  struct Source {
+    std::uint8_t const *dataHandle{nullptr};
+    size_t byteCount{0U};
+    size_t primitiveSize{1U};
+    bool isSwapped{false};
+
+    // Computes the character from up to 3 bytes. Swapped elements cost a
+    // division per character, so ForEachChunk is the fast path for consumers
+    // which go through the whole buffer.
+    [[nodiscard]]
+    char GetChar(size_t index) const noexcept {
+      const size_t unitByteBegin = index / charCountBase64 * byteCountBase64;
+      const size_t charIndex = index % charCountBase64;
+      const size_t validByteCount =
+        std::min(byteCountBase64, byteCount - unitByteBegin);
+
+      // 1 byte only fills 2 characters and 2 bytes 3 characters.
+      if (charIndex > validByteCount) {
+        return paddingCharBase64;
+      }
+
+      std::array<std::uint8_t, byteCountBase64> unitData{};
+
+      LoadUnitBytes(unitByteBegin, validByteCount, unitData);
+
+      const std::uint32_t value = Detail::LoadUnit(std::data(unitData));
+      const size_t shift =
+        (charCountBase64 - 1U - charIndex) * bitCountCharBase64;
+
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      return characterMapBase64[(value >> shift) & Detail::lower6BitsMask];
+    }
+
+    // The bytes of a unit in the encoded order. The position in the element is
+    // found once per unit, and the bytes after it step through the elements.
+    void LoadUnitBytes(
+      size_t byteIndex, size_t validByteCount,
+      std::array<std::uint8_t, byteCountBase64> &unitData) const noexcept {
+      // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+      if (!isSwapped) {
+        for (size_t index = 0U; index < validByteCount; ++index) {
+          unitData[index] = dataHandle[byteIndex + index];
+        }
+
+        return;
+      }
+
+      size_t elementBegin = byteIndex / primitiveSize * primitiveSize;
+      size_t elementByteIndex = byteIndex - elementBegin;
+
+      for (size_t index = 0U; index < validByteCount; ++index) {
+        unitData[index] =
+          dataHandle[elementBegin + primitiveSize - 1U - elementByteIndex];
+
+        if (++elementByteIndex == primitiveSize) {
+          elementBegin += primitiveSize;
+          elementByteIndex = 0U;
+        }
+      }
+      // NOLINTEND(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+    }
+  };
+
+public:
+  // The iterators are the source and a character index, and each character is
+  // computed on dereference.
+  class Iterator {
+  public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = char;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+    Iterator(const Source &source, size_t index) noexcept
+      : m_source{source}, m_index{index} {}
+
+    [[nodiscard]]
+    char operator*() const noexcept {
+      return m_source.GetChar(m_index);
+    }
+    [[nodiscard]]
+    char operator[](difference_type offset) const noexcept {
+      return m_source.GetChar(m_index + static_cast<size_t>(offset));
+    }
+
+    Iterator &operator++() noexcept {
+      ++m_index;
+
+      return *this;
+    }
+    Iterator operator++(int) noexcept {
+      Iterator previous = *this;
+
+      ++m_index;
+
+      return previous;
+    }
+    Iterator &operator--() noexcept {
+      --m_index;
+
+      return *this;
+    }
+    Iterator operator--(int) noexcept {
+      Iterator previous = *this;
+
+      --m_index;
+
+      return previous;
+    }
+
+    Iterator &operator+=(difference_type offset) noexcept {
+      m_index += static_cast<size_t>(offset);
+
+      return *this;
+    }
+    Iterator &operator-=(difference_type offset) noexcept {
+      m_index -= static_cast<size_t>(offset);
+
+      return *this;
+    }
+
+    [[nodiscard]]
+    friend Iterator operator+(Iterator iterator,
+                              difference_type offset) noexcept {
+      return iterator += offset;
+    }
+    [[nodiscard]]
+    friend Iterator operator+(difference_type offset,
+                              Iterator iterator) noexcept {
+      return iterator += offset;
+    }
+    [[nodiscard]]
+    friend Iterator operator-(Iterator iterator,
+                              difference_type offset) noexcept {
+      return iterator -= offset;
+    }
+    [[nodiscard]]
+    friend difference_type operator-(const Iterator &lhs,
+                                     const Iterator &rhs) noexcept {
+      return static_cast<difference_type>(lhs.m_index) -
+             static_cast<difference_type>(rhs.m_index);
+    }
+
+    [[nodiscard]]
+    friend bool operator==(const Iterator &lhs, const Iterator &rhs) noexcept {
+      return lhs.m_index == rhs.m_index;
+    }
+    [[nodiscard]]
+    friend std::strong_ordering operator<=>(const Iterator &lhs,
+                                            const Iterator &rhs) noexcept {
+      return lhs.m_index <=> rhs.m_index;
+    }
+
+  private:
+    Source m_source{};
+    size_t m_index{0U};
+  };
+
+  // The characters are handed out in chunks of at most this many, each a
+  // multiple of LCM(3, primitiveSize) bytes, so only the last chunk has
+  // padding.
+  static constexpr size_t chunkCharCount = 4096U;
+
+  Base64View() = default;
+  Base64View(void const *dataHandle, size_t elementCount, size_t primitiveSize,
+             std::endian byteOrder = std::endian::big) noexcept
+    : m_source{.dataHandle = static_cast<std::uint8_t const *>(dataHandle),
+               .byteCount = elementCount * primitiveSize,
+               .primitiveSize = primitiveSize,
+               .isSwapped =
+                 primitiveSize > 1U && byteOrder != std::endian::native},
+      m_byteOrder{byteOrder} {
+    if (!AreElementsValidBase64(elementCount, primitiveSize)) {
+      m_source.byteCount = 0U;
+    }
+  }
+
+  [[nodiscard]]
+  Iterator begin() const noexcept {
+    return Iterator{m_source, 0U};
+  }
+  [[nodiscard]]
+  Iterator end() const noexcept {
+    return Iterator{m_source, size()};
+  }
+
+  [[nodiscard]]
+  size_t size() const noexcept {
+    return EncodedCharCountBase64(m_source.byteCount, 1U);
+  }
+
+  // The fast path for consumers which can take blocks of characters, like a
+  // hasher or a writer. The chunks are encoded with the bulk encoders into a
+  // stack buffer, and each string_view is only valid during its call.
+  template <typename Consumer_t>
+    requires std::invocable<Consumer_t &, std::string_view>
+  void ForEachChunk(Consumer_t &&consumer) const {
+    constexpr size_t maxChunkByteCount =
+      chunkCharCount / charCountBase64 * byteCountBase64;
+
+    std::array<char, chunkCharCount> chunkData{};
+
+    const size_t byteCount = m_source.byteCount;
+    const size_t primitiveSize = m_source.primitiveSize;
+    const size_t blockByteCount = std::lcm(byteCountBase64, primitiveSize);
+
+    // A block of very wide elements doesn't fit in the buffer, so its
+    // characters are computed one by one instead.
+    if (blockByteCount > maxChunkByteCount) {
+      const size_t charCount = size();
+
+      for (size_t cIndex = 0U; cIndex < charCount; cIndex += chunkCharCount) {
+        const size_t chunkSize = std::min(chunkCharCount, charCount - cIndex);
+
+        for (size_t index = 0U; index < chunkSize; ++index) {
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+          chunkData[index] = m_source.GetChar(cIndex + index);
+        }
+
+        consumer(std::string_view{std::data(chunkData), chunkSize});
+      }
+
+      return;
+    }
+
+    const size_t chunkByteCount =
+      maxChunkByteCount / blockByteCount * blockByteCount;
+
+    for (size_t bIndex = 0U; bIndex < byteCount; bIndex += chunkByteCount) {
+      const size_t chunkSize = std::min(chunkByteCount, byteCount - bIndex);
+      const size_t charCount = EncodedCharCountBase64(chunkSize, 1U);
+
+      // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      [[maybe_unused]] const bool isEncoded =
+        EncodeBase64(m_source.dataHandle + bIndex, chunkSize / primitiveSize,
+                     primitiveSize, std::span<char>{chunkData}, m_byteOrder);
+      // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      consumer(std::string_view{std::data(chunkData), charCount});
+    }
+  }
+
+private:
+  Source m_source{};
+  std::endian m_byteOrder{std::endian::big};
+};
+
+namespace Detail {
+struct Base64ViewAdaptor {
+  // Temporaries which own their elements would dangle, so only lvalues and
+  // borrowed ranges are taken.
+  template <typename Range_t>
+    requires Base64Range_t<std::remove_cvref_t<Range_t>> &&
+             (std::is_lvalue_reference_v<Range_t> ||
+              std::ranges::borrowed_range<Range_t>)
+  [[nodiscard]]
+  Base64View
+  operator()(Range_t &&data,
+             std::endian byteOrder = std::endian::big) const noexcept {
+    using Element_t = std::ranges::range_value_t<std::remove_cvref_t<Range_t>>;
+
+    return Base64View{std::ranges::data(data), std::ranges::size(data),
+                      sizeof(Element_t), byteOrder};
+  }
+
+  template <typename Range_t>
+    requires std::invocable<const Base64ViewAdaptor &, Range_t>
+  [[nodiscard]]
+  friend Base64View operator|(Range_t &&data,
+                              const Base64ViewAdaptor &adaptor) noexcept {
+    return adaptor(std::forward<Range_t>(data));
+  }
+};
+} // namespace Detail
+
+// data | viewBase64 | std::views::take(8), or viewBase64(data,
+// std::endian::little) for another byte order.
+inline constexpr Detail::Base64ViewAdaptor viewBase64{};
+} // namespace Phobos
+
+// The iterators only point into the buffer, so they outlive the view.
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<Phobos::Base64View> =
+  true;
+#endif
@@ -0,0 +1,402 @@
+#include <Base64Calibration.hpp>
+#include <Base64EncodeService.hpp>
+#include <Base64Encoder.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <bitset>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Phobos {
+// Fits in the L1 cache of any recent CPU.
+static constexpr size_t s_cachedByteCount = 16U * 1024U;
+// Big enough for the stores to go to memory on most machines while still
+// taking only a few milliseconds.
+static constexpr size_t s_uncachedByteCount = 4U * 1024U * 1024U;
+static constexpr size_t s_cachedRepeatCount = 32U;
+static constexpr size_t s_uncachedRepeatCount = 3U;
+static constexpr size_t s_handoffRepeatCount = 32U;
+
+// A job below the inline threshold takes this many handoffs to encode, and a
+// chunk this many.
+static constexpr size_t s_inlineHandoffCount = 4U;
+static constexpr size_t s_chunkHandoffCount = 64U;
+
+static constexpr size_t s_minInlineThreshold = 4U * 1024U;
+static constexpr size_t s_minChunkByteCount = 64U * 1024U;
+static constexpr size_t s_maxChunkByteCount = 4U * 1024U * 1024U;
+
+// Streaming has to be within 10% of the normal stores to be turned on.
+static constexpr double s_streamingTolerance = 0.9;
+
+static constexpr size_t s_nanosecondsPerSecond = 1'000'000'000U;
+static constexpr size_t s_kiloByte = 1024U;
+
+namespace {
+using Clock_t = std::chrono::steady_clock;
+
+[[nodiscard]]
+std::vector<std::uint8_t> MakeCalibrationData(size_t byteCount) {
+  std::vector<std::uint8_t> data(byteCount, 0U);
+
+  // Some noise, so the repeated block path doesn't kick in.
+  std::uint32_t state = 0x12345678U;
+
+  for (std::uint8_t &byte : data) {
+    // NOLINTBEGIN(*-magic-numbers)
+    state = state * 1664525U + 1013904223U;
+    byte = static_cast<std::uint8_t>(state >> 24U);
+    // NOLINTEND(*-magic-numbers)
+  }
+
+  return data;
+}
+
+// The best of the repeats, in nanoseconds.
+[[nodiscard]]
+size_t MeasureEncode(const std::vector<std::uint8_t> &data,
+                     std::vector<char> &encodedData, size_t repeatCount,
+                     bool isStreaming) {
+  auto bestTime = Clock_t::duration::max();
+
+  for (size_t index = 0U; index < repeatCount; ++index) {
+    const auto startTime = Clock_t::now();
+
+    [[maybe_unused]] const bool isEncoded = Detail::EncodeBase64InMode(
+      std::data(data), std::size(data), 1U, std::span<char>{encodedData},
+      std::endian::big, isStreaming);
+
+    bestTime = std::min(bestTime, Clock_t::now() - startTime);
+  }
+
+  return std::max(
+    static_cast<size_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(bestTime).count()),
+    size_t{1U});
+}
+
+[[nodiscard]]
+size_t GetBytesPerSecond(size_t byteCount, size_t nanoseconds) noexcept {
+  return static_cast<size_t>(static_cast<double>(byteCount) *
+                             static_cast<double>(s_nanosecondsPerSecond) /
+                             static_cast<double>(nanoseconds));
+}
+
+// Ping pongs with a thread which waits on an atomic, same as a worker which
+// waits for a chunk. Returns the median of a round trip.
+[[nodiscard]]
+size_t MeasureHandoff() {
+  std::atomic<size_t> request{0U};
+  std::atomic<size_t> response{0U};
+
+  std::thread responder{[&request, &response] {
+    for (size_t index = 1U; index <= s_handoffRepeatCount; ++index) {
+      while (request.load(std::memory_order_acquire) != index) {
+        request.wait(index - 1U, std::memory_order_acquire);
+      }
+
+      response.store(index, std::memory_order_release);
+      response.notify_one();
+    }
+  }};
+
+  std::array<size_t, s_handoffRepeatCount> roundTrips{};
+
+  for (size_t index = 1U; index <= s_handoffRepeatCount; ++index) {
+    const auto startTime = Clock_t::now();
+
+    request.store(index, std::memory_order_release);
+    request.notify_one();
+
+    while (response.load(std::memory_order_acquire) != index) {
+      response.wait(index - 1U, std::memory_order_acquire);
+    }
+
+    roundTrips[index - 1U] = static_cast<size_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_t::now() -
+                                                           startTime)
+        .count());
+  }
+
+  responder.join();
+
+  auto median = std::begin(roundTrips) + s_handoffRepeatCount / 2U;
+
+  std::ranges::nth_element(roundTrips, median);
+
+  return std::max(*median, size_t{1U});
+}
+
+// The size of the highest level cache of the first CPU from sysfs, nullopt
+// elsewhere.
+[[nodiscard]]
+std::optional<size_t> GetLastLevelCacheSize() {
+  std::optional<size_t> cacheSize{};
+
+  for (size_t index = 0U;; ++index) {
+    std::ifstream sizeFile{"/sys/devices/system/cpu/cpu0/cache/index" +
+                           std::to_string(index) + "/size"};
+
+    if (!sizeFile) {
+      break;
+    }
+
+    size_t kiloBytes = 0U;
+
+    // The sizes are written as "32768K".
+    if (sizeFile >> kiloBytes) {
+      cacheSize = std::max(cacheSize.value_or(0U), kiloBytes * s_kiloByte);
+    }
+  }
+
+  return cacheSize;
+}
+
+[[nodiscard]]
+size_t RoundDownToPowerOfTwo(size_t value) noexcept {
+  return value == 0U ? 0U : std::bit_floor(value);
+}
+
+[[nodiscard]]
+std::optional<size_t> ParseSize(std::string_view text) noexcept {
+  size_t value = 0U;
+
+  const auto [end, error] =
+    std::from_chars(std::data(text), std::data(text) + std::size(text), value);
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  if (error != std::errc{} || end != std::data(text) + std::size(text)) {
+    return {};
+  }
+
+  return value;
+}
+} // namespace
+
+std::string GetCpuModelName() {
+  std::ifstream cpuInfo{"/proc/cpuinfo"};
+
+  constexpr std::string_view modelKey = "model name";
+
+  std::string line{};
+
+  while (std::getline(cpuInfo, line)) {
+    if (!line.starts_with(modelKey)) {
+      continue;
+    }
+
+    const size_t separator = line.find(':');
+
+    if (separator == std::string::npos) {
+      break;
+    }
+
+    const size_t modelStart = line.find_first_not_of(' ', separator + 1U);
+
+    if (modelStart != std::string::npos) {
+      return line.substr(modelStart);
+    }
+  }
+
+  return "unknown";
+}
+
+EncodeCalibration CalibrateEncode() {
+  EncodeCalibration calibration{
+    .cpuModel = GetCpuModelName(),
+    .hardwareConcurrency = std::max(std::thread::hardware_concurrency(), 1U),
+    .encodeBytesPerSecond = 0U,
+    .handoffNanoseconds = MeasureHandoff(),
+    .inlineThreshold = 0U,
+    .chunkByteCount = 0U,
+    .streamingThreshold = 0U};
+
+  {
+    const std::vector<std::uint8_t> data =
+      MakeCalibrationData(s_cachedByteCount);
+
+    std::vector<char> encodedData(
+      EncodedCharCountBase64(s_cachedByteCount, 1U));
+
+    calibration.encodeBytesPerSecond = GetBytesPerSecond(
+      s_cachedByteCount,
+      MeasureEncode(data, encodedData, s_cachedRepeatCount, false));
+  }
+
+  const double bytesPerHandoff =
+    static_cast<double>(calibration.encodeBytesPerSecond) *
+    static_cast<double>(calibration.handoffNanoseconds) /
+    static_cast<double>(s_nanosecondsPerSecond);
+
+  calibration.inlineThreshold = std::max(
+    static_cast<size_t>(bytesPerHandoff * s_inlineHandoffCount),
+    s_minInlineThreshold);
+  calibration.chunkByteCount = std::clamp(
+    RoundDownToPowerOfTwo(
+      static_cast<size_t>(bytesPerHandoff * s_chunkHandoffCount)),
+    s_minChunkByteCount, s_maxChunkByteCount);
+
+  {
+    const std::vector<std::uint8_t> data =
+      MakeCalibrationData(s_uncachedByteCount);
+
+    std::vector<char> encodedData(
+      EncodedCharCountBase64(s_uncachedByteCount, 1U));
+
+    const size_t normalTime =
+      MeasureEncode(data, encodedData, s_uncachedRepeatCount, false);
+    const size_t streamingTime =
+      MeasureEncode(data, encodedData, s_uncachedRepeatCount, true);
+
+    if (static_cast<double>(normalTime) >=
+        static_cast<double>(streamingTime) * s_streamingTolerance) {
+      calibration.streamingThreshold =
+        GetLastLevelCacheSize().value_or(defaultStreamingThresholdBase64);
+    }
+  }
+
+  return calibration;
+}
+
+size_t ApplyEncodeCalibration(const EncodeCalibration &calibration,
+                              EncodeService &service) noexcept {
+  const size_t streamingThreshold = GetStreamingThresholdBase64();
+
+  SetStreamingThresholdBase64(calibration.streamingThreshold);
+
+  service.SetInlineThreshold(calibration.inlineThreshold);
+  service.SetChunkByteCount(calibration.chunkByteCount);
+
+  return streamingThreshold;
+}
+
+std::optional<EncodeCalibration>
+LoadEncodeCalibration(const std::filesystem::path &filePath) {
+  std::ifstream calibrationFile{filePath};
+
+  if (!calibrationFile) {
+    return {};
+  }
+
+  EncodeCalibration calibration{};
+
+  // Every key must be there exactly once.
+  constexpr std::array<std::string_view, 7U> keys{
+    "cpuModel",           "hardwareConcurrency", "encodeBytesPerSecond",
+    "handoffNanoseconds", "inlineThreshold",     "chunkByteCount",
+    "streamingThreshold"};
+
+  std::bitset<std::size(keys)> foundKeys{};
+
+  std::string line{};
+
+  while (std::getline(calibrationFile, line)) {
+    const size_t separator = line.find('=');
+
+    if (separator == std::string::npos) {
+      return {};
+    }
+
+    const std::string_view key = std::string_view{line}.substr(0U, separator);
+    const std::string_view value =
+      std::string_view{line}.substr(separator + 1U);
+
+    const auto keyIt = std::ranges::find(keys, key);
+
+    if (keyIt == std::end(keys)) {
+      return {};
+    }
+
+    const auto keyIndex =
+      static_cast<size_t>(std::distance(std::begin(keys), keyIt));
+
+    if (foundKeys.test(keyIndex)) {
+      return {};
+    }
+
+    foundKeys.set(keyIndex);
+
+    if (key == "cpuModel") {
+      calibration.cpuModel = value;
+
+      continue;
+    }
+
+    const std::optional<size_t> size = ParseSize(value);
+
+    if (!size) {
+      return {};
+    }
+
+    if (key == "hardwareConcurrency") {
+      calibration.hardwareConcurrency = *size;
+    } else if (key == "encodeBytesPerSecond") {
+      calibration.encodeBytesPerSecond = *size;
+    } else if (key == "handoffNanoseconds") {
+      calibration.handoffNanoseconds = *size;
+    } else if (key == "inlineThreshold") {
+      calibration.inlineThreshold = *size;
+    } else if (key == "chunkByteCount") {
+      calibration.chunkByteCount = *size;
+    } else {
+      calibration.streamingThreshold = *size;
+    }
+  }
+
+  const bool isSameMachine =
+    calibration.cpuModel == GetCpuModelName() &&
+    calibration.hardwareConcurrency ==
+      std::max(std::thread::hardware_concurrency(), 1U);
+
+  if (!foundKeys.all() || !isSameMachine) {
+    return {};
+  }
+
+  return calibration;
+}
+
+bool SaveEncodeCalibration(const std::filesystem::path &filePath,
+                           const EncodeCalibration &calibration) {
+  std::ofstream calibrationFile{filePath, std::ios::trunc};
+
+  calibrationFile << "cpuModel=" << calibration.cpuModel << '\n'
+                  << "hardwareConcurrency=" << calibration.hardwareConcurrency
+                  << '\n'
+                  << "encodeBytesPerSecond="
+                  << calibration.encodeBytesPerSecond << '\n'
+                  << "handoffNanoseconds=" << calibration.handoffNanoseconds
+                  << '\n'
+                  << "inlineThreshold=" << calibration.inlineThreshold << '\n'
+                  << "chunkByteCount=" << calibration.chunkByteCount << '\n'
+                  << "streamingThreshold=" << calibration.streamingThreshold
+                  << '\n';
+
+  return static_cast<bool>(calibrationFile);
+}
+
+EncodeCalibration LoadOrCalibrateEncode(const std::filesystem::path &filePath) {
+  if (std::optional<EncodeCalibration> calibration =
+        LoadEncodeCalibration(filePath)) {
+    return *calibration;
+  }
+
+  EncodeCalibration calibration = CalibrateEncode();
+
+  // Calibrating again next time is the only cost of a failed save.
+  [[maybe_unused]] const bool isSaved =
+    SaveEncodeCalibration(filePath, calibration);
+
+  return calibration;
+}
+} // namespace Phobos
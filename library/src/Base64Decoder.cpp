@@ -0,0 +1,456 @@
+#include <Base64Decoder.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+
+namespace Phobos {
+// The scan is done in blocks, so the per character work is a lookup and an OR
+// without any branches, which lets the compiler vectorise it.
+static constexpr size_t s_validationBlockSize = 64U;
+static constexpr std::uint8_t s_whitespaceValue = 0xFEU;
+
+namespace {
+[[nodiscard]]
+bool AreCharactersValid(
+  std::string_view encodedData,
+  const std::array<std::uint8_t, decodeMapSizeBase64> &decodeMap) noexcept {
+  const size_t characterCount = std::size(encodedData);
+
+  size_t index = 0U;
+
+  for (; index + s_validationBlockSize <= characterCount;
+       index += s_validationBlockSize) {
+    std::uint8_t accumulatedValue = 0U;
+
+    for (size_t offset = 0U; offset < s_validationBlockSize; ++offset) {
+      const auto character =
+        static_cast<unsigned char>(encodedData[index + offset]);
+
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      accumulatedValue |= decodeMap[character];
+    }
+
+    if (accumulatedValue > Detail::maxValidValueBase64) {
+      return false;
+    }
+  }
+
+  std::uint8_t accumulatedValue = 0U;
+
+  for (; index < characterCount; ++index) {
+    const auto character = static_cast<unsigned char>(encodedData[index]);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    accumulatedValue |= decodeMap[character];
+  }
+
+  return accumulatedValue <= Detail::maxValidValueBase64;
+}
+
+[[nodiscard]]
+size_t GetPaddingCount(std::string_view encodedData) noexcept {
+  const size_t characterCount = std::size(encodedData);
+
+  size_t paddingCount = 0U;
+
+  if (characterCount != 0U &&
+      encodedData[characterCount - 1U] == paddingCharBase64) {
+    ++paddingCount;
+
+    if (encodedData[characterCount - 2U] == paddingCharBase64) {
+      ++paddingCount;
+    }
+  }
+
+  return paddingCount;
+}
+
+// The strict map with the whitespace characters marked, so the lenient decoder
+// tells them apart from the invalid ones with a single lookup.
+[[nodiscard]]
+consteval std::array<std::uint8_t, decodeMapSizeBase64>
+MakeLenientDecodeMap() {
+  std::array<std::uint8_t, decodeMapSizeBase64> decodeMap{decodeMapBase64};
+
+  for (const char character : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+    decodeMap.at(static_cast<unsigned char>(character)) = s_whitespaceValue;
+  }
+
+  return decodeMap;
+}
+
+constexpr std::array s_lenientDecodeMap{MakeLenientDecodeMap()};
+
+[[nodiscard]]
+bool IsPrimitiveSizeSupported(size_t primitiveSize) noexcept {
+  return primitiveSize == 1U || primitiveSize == 2U || primitiveSize == 4U ||
+         primitiveSize == 8U;
+}
+
+// Where each byte of a block of big endian elements goes in the output. A block
+// is LCM(3, primitiveSize) bytes, so it is made of whole units and whole
+// elements.
+template <size_t primitiveSize, bool isSwapped>
+[[nodiscard]]
+consteval auto MakeByteMap() {
+  constexpr size_t blockByteCount = std::lcm(byteCountBase64, primitiveSize);
+
+  std::array<size_t, blockByteCount> byteMap{};
+
+  for (size_t index = 0U; index < blockByteCount; ++index) {
+    const size_t elementBegin = index / primitiveSize * primitiveSize;
+    const size_t byteIndex = index % primitiveSize;
+
+    byteMap.at(index) =
+      elementBegin + (isSwapped ? primitiveSize - 1U - byteIndex : byteIndex);
+  }
+
+  return byteMap;
+}
+
+// The unpacked bytes of each unit are written straight to their reordered
+// places, so there isn't a separate byteswap pass. The decoded byte count must
+// be a multiple of the primitive size.
+template <size_t primitiveSize, bool isSwapped>
+[[nodiscard]]
+bool DecodeElements(std::string_view encodedData,
+                    std::uint8_t *decodedData) noexcept {
+  constexpr auto byteMap = MakeByteMap<primitiveSize, isSwapped>();
+  constexpr size_t blockByteCount = std::size(byteMap);
+  constexpr size_t unitCountPerBlock = blockByteCount / byteCountBase64;
+
+  const size_t byteCount = DecodedByteCountBase64(encodedData);
+  const size_t lastUnitIndex = std::size(encodedData) / charCountBase64 - 1U;
+  const size_t paddingCount = GetPaddingCount(encodedData);
+
+  std::array<std::uint8_t, byteCountBase64> decodedUnit{};
+
+  // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+  for (size_t bIndex = 0U; bIndex < byteCount; bIndex += blockByteCount) {
+    const size_t firstUnitIndex = bIndex / byteCountBase64;
+
+    // Only the last block can be partial.
+    const size_t validByteCount = std::min(blockByteCount, byteCount - bIndex);
+
+    for (size_t unitIndex = 0U; unitIndex < unitCountPerBlock; ++unitIndex) {
+      const size_t unitByteBegin = unitIndex * byteCountBase64;
+
+      if (unitByteBegin >= validByteCount) {
+        break;
+      }
+
+      const size_t encodedUnitIndex = firstUnitIndex + unitIndex;
+      const size_t validCharCount = encodedUnitIndex == lastUnitIndex
+                                      ? charCountBase64 - paddingCount
+                                      : charCountBase64;
+
+      if (!Detail::DecodeUnit(std::data(encodedData) +
+                                encodedUnitIndex * charCountBase64,
+                              validCharCount, decodedUnit)) {
+        return false;
+      }
+
+      const size_t unitByteCount =
+        std::min(byteCountBase64, validByteCount - unitByteBegin);
+
+      for (size_t index = 0U; index < unitByteCount; ++index) {
+        decodedData[bIndex + byteMap[unitByteBegin + index]] =
+          decodedUnit[index];
+      }
+    }
+  }
+  // NOLINTEND(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+
+  return true;
+}
+
+template <size_t primitiveSize>
+[[nodiscard]]
+bool DecodeElements(std::string_view encodedData, std::uint8_t *decodedData,
+                    std::endian byteOrder) noexcept {
+  if (byteOrder == std::endian::native) {
+    return DecodeElements<primitiveSize, false>(encodedData, decodedData);
+  }
+
+  return DecodeElements<primitiveSize, true>(encodedData, decodedData);
+}
+
+[[nodiscard]]
+bool ValidateBase64(
+  std::string_view encodedData,
+  const std::array<std::uint8_t, decodeMapSizeBase64> &decodeMap,
+  bool isPaddingOptional) noexcept {
+  const size_t characterCount = std::size(encodedData);
+  const size_t remainder = characterCount % charCountBase64;
+
+  // A single character can only hold 6bits, which isn't a full byte.
+  if (remainder == 1U || (!isPaddingOptional && remainder != 0U)) {
+    return false;
+  }
+
+  // The padding can only be on the last two characters of the last unit. Any
+  // other '=' will be caught by the alphabet check.
+  const size_t paddingCount =
+    remainder == 0U ? GetPaddingCount(encodedData) : 0U;
+
+  return AreCharactersValid(
+    encodedData.substr(0U, characterCount - paddingCount), decodeMap);
+}
+} // namespace
+
+bool IsValidBase64(std::string_view encodedData) noexcept {
+  return ValidateBase64(encodedData, decodeMapBase64, false);
+}
+
+bool IsValidBase64Url(std::string_view encodedData) noexcept {
+  return ValidateBase64(encodedData, decodeMapBase64Url, true);
+}
+
+size_t DecodedByteCountBase64(std::string_view encodedData) noexcept {
+  const size_t characterCount = std::size(encodedData);
+
+  if (characterCount % charCountBase64 != 0U) {
+    return 0U;
+  }
+
+  return characterCount / charCountBase64 * byteCountBase64 -
+         GetPaddingCount(encodedData);
+}
+
+std::optional<std::vector<std::uint8_t>>
+DecodeBase64Range(std::string_view encodedData, size_t elementOffset,
+                  size_t elementCount, size_t primitiveSize) noexcept {
+  if (!IsPrimitiveSizeSupported(primitiveSize)) {
+    return std::nullopt;
+  }
+
+  const size_t decodedByteCount = DecodedByteCountBase64(encodedData);
+  const size_t elementLimit = decodedByteCount / primitiveSize;
+
+  if (elementOffset > elementLimit ||
+      elementCount > elementLimit - elementOffset) {
+    return std::nullopt;
+  }
+
+  const size_t byteBegin = elementOffset * primitiveSize;
+  const size_t byteEnd = byteBegin + elementCount * primitiveSize;
+
+  std::vector<std::uint8_t> decodedData(byteEnd - byteBegin, 0U);
+
+  const size_t lastUnitIndex = std::size(encodedData) / charCountBase64 - 1U;
+  const size_t paddingCount = GetPaddingCount(encodedData);
+
+  std::array<std::uint8_t, byteCountBase64> decodedUnit{};
+
+  size_t dIndex = 0U;
+
+  // Only the units which cover the range are decoded, the first and the last
+  // ones might only be partially needed.
+  for (size_t unitIndex = byteBegin / byteCountBase64;
+       dIndex < std::size(decodedData); ++unitIndex) {
+    const size_t validCharCount = unitIndex == lastUnitIndex
+                                    ? charCountBase64 - paddingCount
+                                    : charCountBase64;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (!Detail::DecodeUnit(std::data(encodedData) +
+                              unitIndex * charCountBase64,
+                            validCharCount, decodedUnit)) {
+      return std::nullopt;
+    }
+
+    const size_t unitByteBegin = unitIndex * byteCountBase64;
+    const size_t copyBegin = std::max(byteBegin, unitByteBegin) - unitByteBegin;
+    const size_t copyEnd =
+      std::min(byteEnd, unitByteBegin + byteCountBase64) - unitByteBegin;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    memcpy(std::data(decodedData) + dIndex, std::data(decodedUnit) + copyBegin,
+           copyEnd - copyBegin);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    dIndex += copyEnd - copyBegin;
+  }
+
+  if constexpr (std::endian::native == std::endian::little) {
+    if (primitiveSize > 1U) {
+      for (auto elementBegin = std::begin(decodedData);
+           elementBegin != std::end(decodedData);
+           elementBegin += static_cast<std::ptrdiff_t>(primitiveSize)) {
+        std::reverse(
+          elementBegin,
+          elementBegin + static_cast<std::ptrdiff_t>(primitiveSize));
+      }
+    }
+  }
+
+  return decodedData;
+}
+
+bool DecodeBase64(std::string_view encodedData, void *dataHandle,
+                  size_t elementCount, size_t primitiveSize,
+                  std::endian byteOrder) noexcept {
+  if (!IsPrimitiveSizeSupported(primitiveSize) ||
+      std::size(encodedData) % charCountBase64 != 0U ||
+      DecodedByteCountBase64(encodedData) != elementCount * primitiveSize) {
+    return false;
+  }
+
+  if (elementCount == 0U) {
+    return true;
+  }
+
+  auto *decodedData = static_cast<std::uint8_t *>(dataHandle);
+
+  if (primitiveSize == 1U) {
+    return DecodeElements<1U, false>(encodedData, decodedData);
+  }
+
+  if (primitiveSize == 2U) {
+    return DecodeElements<2U>(encodedData, decodedData, byteOrder);
+  }
+
+  if (primitiveSize == 4U) {
+    return DecodeElements<4U>(encodedData, decodedData, byteOrder);
+  }
+
+  return DecodeElements<8U>(encodedData, decodedData, byteOrder);
+}
+
+std::optional<std::vector<std::uint8_t>>
+DecodeBase64(std::string_view encodedData, size_t primitiveSize) noexcept {
+  // A length which isn't a multiple of 4 decodes to 0 bytes, which would be a
+  // valid empty range, and a partial last element would be cut off silently.
+  const size_t byteCount = DecodedByteCountBase64(encodedData);
+
+  if (!IsPrimitiveSizeSupported(primitiveSize) ||
+      std::size(encodedData) % charCountBase64 != 0U ||
+      byteCount % primitiveSize != 0U) {
+    return std::nullopt;
+  }
+
+  return DecodeBase64Range(encodedData, 0U, byteCount / primitiveSize,
+                           primitiveSize);
+}
+
+std::optional<size_t>
+DecodeBase64Lenient(std::string_view encodedData,
+                    std::span<std::uint8_t> decodedData) noexcept {
+  const size_t characterCount = std::size(encodedData);
+  const size_t byteLimit = std::size(decodedData);
+
+  // The characters of a unit which was split by whitespace are gathered here.
+  std::array<char, charCountBase64> pendingUnit{};
+  size_t pendingCount = 0U;
+
+  size_t index = 0U;
+  size_t dIndex = 0U;
+
+  // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+  while (index < characterCount) {
+    // Most of the input is runs of whole units between the line breaks, which
+    // are decoded in place like the strict decoder does.
+    if (pendingCount == 0U && index + charCountBase64 <= characterCount &&
+        dIndex + byteCountBase64 <= byteLimit &&
+        Detail::DecodeFullUnit(std::data(encodedData) + index,
+                               std::data(decodedData) + dIndex)) {
+      index += charCountBase64;
+      dIndex += byteCountBase64;
+
+      continue;
+    }
+
+    const char character = encodedData[index];
+    const std::uint8_t value =
+      s_lenientDecodeMap[static_cast<unsigned char>(character)];
+
+    if (value == s_whitespaceValue) {
+      ++index;
+
+      continue;
+    }
+
+    if (value > Detail::maxValidValueBase64) {
+      break;
+    }
+
+    pendingUnit[pendingCount] = character;
+    ++pendingCount;
+    ++index;
+
+    if (pendingCount == charCountBase64) {
+      if (dIndex + byteCountBase64 > byteLimit ||
+          !Detail::DecodeFullUnit(std::data(pendingUnit),
+                                  std::data(decodedData) + dIndex)) {
+        return std::nullopt;
+      }
+
+      dIndex += byteCountBase64;
+      pendingCount = 0U;
+    }
+  }
+
+  // Only the padding and whitespace can follow, and the padding must complete
+  // the last unit.
+  size_t paddingCount = 0U;
+
+  for (; index < characterCount; ++index) {
+    const char character = encodedData[index];
+
+    if (character == paddingCharBase64) {
+      ++paddingCount;
+    } else if (s_lenientDecodeMap[static_cast<unsigned char>(character)] !=
+               s_whitespaceValue) {
+      return std::nullopt;
+    }
+  }
+  // NOLINTEND(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+
+  if (pendingCount == 0U) {
+    return paddingCount == 0U ? std::optional{dIndex} : std::nullopt;
+  }
+
+  // A unit needs at least 2 characters for a whole byte.
+  const size_t unitByteCount = pendingCount - 1U;
+
+  if (pendingCount < 2U || pendingCount + paddingCount != charCountBase64 ||
+      dIndex + unitByteCount > byteLimit) {
+    return std::nullopt;
+  }
+
+  std::array<std::uint8_t, byteCountBase64> decodedUnit{};
+
+  if (!Detail::DecodeUnit(std::data(pendingUnit), pendingCount, decodedUnit)) {
+    return std::nullopt;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  memcpy(std::data(decodedData) + dIndex, std::data(decodedUnit),
+         unitByteCount);
+
+  return dIndex + unitByteCount;
+}
+
+std::optional<std::vector<std::uint8_t>>
+DecodeBase64Lenient(std::string_view encodedData) noexcept {
+  // The whitespace only makes the input longer, so this is an upper bound.
+  std::vector<std::uint8_t> decodedData(
+    (std::size(encodedData) + charCountBase64 - 1U) / charCountBase64 *
+      byteCountBase64,
+    0U);
+
+  const std::optional<size_t> byteCount =
+    DecodeBase64Lenient(encodedData, decodedData);
+
+  if (!byteCount) {
+    return std::nullopt;
+  }
+
+  decodedData.resize(*byteCount);
+
+  return decodedData;
+}
+} // namespace Phobos
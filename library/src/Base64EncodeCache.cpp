@@ -0,0 +1,178 @@
+#include <Base64EncodeCache.hpp>
+#include <Base64Encoder.hpp>
+#include <cstring>
+
+namespace Phobos {
+// From the 64bits murmur3 finalizer.
+static constexpr std::uint64_t s_hashMultiplier = 0xff51afd7ed558ccdLLU;
+static constexpr std::uint64_t s_hashSeed = 0x9e3779b97f4a7c15LLU;
+static constexpr size_t s_hashShift = 33U;
+
+namespace {
+[[nodiscard]]
+constexpr std::uint64_t MixWord(std::uint64_t hash,
+                                std::uint64_t word) noexcept {
+  hash ^= word;
+  hash *= s_hashMultiplier;
+
+  return hash ^ (hash >> s_hashShift);
+}
+} // namespace
+
+std::uint64_t HashBytesBase64(void const *dataHandle,
+                              size_t byteCount) noexcept {
+  auto const *dataHandleU8 = static_cast<std::uint8_t const *>(dataHandle);
+
+  std::uint64_t hash = s_hashSeed ^ byteCount;
+
+  size_t index = 0U;
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (; index + sizeof(std::uint64_t) <= byteCount;
+       index += sizeof(std::uint64_t)) {
+    std::uint64_t word = 0U;
+
+    memcpy(&word, dataHandleU8 + index, sizeof(std::uint64_t));
+
+    hash = MixWord(hash, word);
+  }
+
+  if (index < byteCount) {
+    std::uint64_t word = 0U;
+
+    memcpy(&word, dataHandleU8 + index, byteCount - index);
+
+    hash = MixWord(hash, word);
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  return MixWord(hash, byteCount);
+}
+
+EncodeCache::EncodeCache(size_t byteBudget)
+  : m_byteBudget{byteBudget}, m_byteCount{0U}, m_hitCount{0U},
+    m_missCount{0U}, m_evictionCount{0U} {}
+
+EncodeCache::Encoded_t EncodeCache::EncodeBase64Str(void const *dataHandle,
+                                                    size_t elementCount,
+                                                    size_t primitiveSize,
+                                                    std::endian byteOrder) {
+  // Not a hit or a miss, and the size can't be hashed as it may overflow.
+  if (!AreElementsValidBase64(elementCount, primitiveSize)) {
+    return std::make_shared<const std::string>();
+  }
+
+  const size_t byteCount = elementCount * primitiveSize;
+
+  const Key key{.hash = HashBytesBase64(dataHandle, byteCount),
+                .byteCount = byteCount,
+                .primitiveSize = primitiveSize,
+                .byteOrder = byteOrder};
+
+  size_t byteBudget = 0U;
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    byteBudget = m_byteBudget;
+
+    auto entry = m_entryMap.find(key);
+
+    if (entry != std::end(m_entryMap) &&
+        (byteCount == 0U || memcmp(std::data(entry->second->sourceData),
+                                   dataHandle, byteCount) == 0)) {
+      m_entries.splice(std::begin(m_entries), m_entries, entry->second);
+
+      ++m_hitCount;
+
+      return entry->second->encodedData;
+    }
+
+    ++m_missCount;
+  }
+
+  // The encode doesn't hold the lock, so two threads which miss on the same
+  // payload both encode it and the second one replaces the first entry.
+  auto encodedData =
+    std::make_shared<const std::string>(Phobos::EncodeBase64Str(
+      dataHandle, elementCount, primitiveSize, byteOrder));
+
+  if (byteCount + std::size(*encodedData) > byteBudget) {
+    return encodedData;
+  }
+
+  auto const *dataHandleU8 = static_cast<std::uint8_t const *>(dataHandle);
+
+  Entry newEntry{
+    .key = key,
+    .sourceData =
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::vector<std::uint8_t>(dataHandleU8, dataHandleU8 + byteCount),
+    .encodedData = encodedData};
+
+  std::lock_guard lock{m_mutex};
+
+  if (auto entry = m_entryMap.find(key); entry != std::end(m_entryMap)) {
+    m_byteCount -= GetEntryByteCount_(*entry->second);
+
+    m_entries.erase(entry->second);
+    m_entryMap.erase(entry);
+  }
+
+  const size_t entryByteCount = GetEntryByteCount_(newEntry);
+
+  if (entryByteCount > m_byteBudget) {
+    // The budget was lowered while encoding.
+    return encodedData;
+  }
+
+  EvictTo_(m_byteBudget - entryByteCount);
+
+  m_entries.emplace_front(std::move(newEntry));
+  m_entryMap.emplace(key, std::begin(m_entries));
+
+  m_byteCount += entryByteCount;
+
+  return encodedData;
+}
+
+void EncodeCache::SetByteBudget(size_t byteBudget) {
+  std::lock_guard lock{m_mutex};
+
+  m_byteBudget = byteBudget;
+
+  EvictTo_(m_byteBudget);
+}
+
+void EncodeCache::Clear() noexcept {
+  std::lock_guard lock{m_mutex};
+
+  m_entryMap.clear();
+  m_entries.clear();
+
+  m_byteCount = 0U;
+}
+
+void EncodeCache::EvictTo_(size_t byteBudget) noexcept {
+  while (m_byteCount > byteBudget && !std::empty(m_entries)) {
+    const Entry &entry = m_entries.back();
+
+    m_byteCount -= GetEntryByteCount_(entry);
+
+    m_entryMap.erase(entry.key);
+    m_entries.pop_back();
+
+    ++m_evictionCount;
+  }
+}
+
+EncodeCacheStats EncodeCache::GetStats() const noexcept {
+  std::lock_guard lock{m_mutex};
+
+  return EncodeCacheStats{.hitCount = m_hitCount,
+                          .missCount = m_missCount,
+                          .evictionCount = m_evictionCount,
+                          .entryCount = std::size(m_entries),
+                          .byteCount = m_byteCount};
+}
+} // namespace Phobos
@@ -0,0 +1,75 @@
+#include <Base64EncodeJob.hpp>
+#include <Base64Encoder.hpp>
+#include <algorithm>
+#include <numeric>
+
+namespace Phobos {
+// About 10us of encoding, so the clock is read rarely but the time budget is
+// still kept closely.
+static constexpr size_t s_timedSliceByteCount = 12U * 1024U;
+
+EncodeJob::EncodeJob(void const *dataHandle, size_t elementCount,
+                     size_t primitiveSize, std::span<char> encodedData,
+                     std::endian byteOrder) noexcept
+  : m_dataHandle{static_cast<std::uint8_t const *>(dataHandle)},
+    m_primitiveSize{primitiveSize}, m_encodedData{encodedData},
+    m_byteOrder{byteOrder}, m_byteCount{0U}, m_blockByteCount{0U},
+    m_byteIndex{0U}, m_charIndex{0U},
+    m_isValid{AreElementsValidBase64(elementCount, primitiveSize) &&
+              std::size(encodedData) >=
+                EncodedCharCountBase64(elementCount, primitiveSize)} {
+  if (m_isValid) {
+    m_byteCount = elementCount * primitiveSize;
+    m_blockByteCount = std::lcm(byteCountBase64, primitiveSize);
+  }
+}
+
+void EncodeJob::EncodeSlice_(size_t sliceByteCount) noexcept {
+  // Only the last slice isn't a multiple of the block.
+  sliceByteCount = std::min(sliceByteCount, m_byteCount - m_byteIndex);
+
+  [[maybe_unused]] const bool isEncoded = EncodeBase64(
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    m_dataHandle + m_byteIndex, sliceByteCount / m_primitiveSize,
+    m_primitiveSize, m_encodedData.subspan(m_charIndex), m_byteOrder);
+
+  m_byteIndex += sliceByteCount;
+  m_charIndex += EncodedCharCountBase64(sliceByteCount, 1U);
+}
+
+EncodeJobProgress EncodeJob::Step(size_t byteBudget) noexcept {
+  if (!IsComplete()) {
+    EncodeSlice_(std::max(byteBudget / m_blockByteCount, size_t{1U}) *
+                 m_blockByteCount);
+  }
+
+  return GetProgress();
+}
+
+EncodeJobProgress
+EncodeJob::Step(std::chrono::nanoseconds timeBudget) noexcept {
+  using Clock_t = std::chrono::steady_clock;
+
+  if (IsComplete()) {
+    return GetProgress();
+  }
+
+  const auto endTime = Clock_t::now() + timeBudget;
+
+  const size_t sliceByteCount =
+    std::max(s_timedSliceByteCount / m_blockByteCount, size_t{1U}) *
+    m_blockByteCount;
+
+  do {
+    EncodeSlice_(sliceByteCount);
+  } while (!IsComplete() && Clock_t::now() < endTime);
+
+  return GetProgress();
+}
+
+EncodeJobProgress EncodeJob::GetProgress() const noexcept {
+  return EncodeJobProgress{.byteCount = m_byteIndex,
+                           .charCount = m_charIndex,
+                           .isComplete = IsComplete()};
+}
+} // namespace Phobos
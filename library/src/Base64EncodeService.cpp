@@ -0,0 +1,287 @@
+#include <Base64EncodeService.hpp>
+#include <Base64Encoder.hpp>
+#include <algorithm>
+#include <numeric>
+#include <span>
+
+namespace Phobos {
+struct EncodeService::Job {
+  std::string encodedData;
+  std::atomic<size_t> remainingChunkCount{0U};
+  std::promise<std::string> promise;
+  Callback_t callback;
+  std::chrono::steady_clock::time_point submitTime;
+
+  void Deliver() {
+    if (callback) {
+      callback(std::move(encodedData));
+    } else {
+      promise.set_value(std::move(encodedData));
+    }
+  }
+};
+
+EncodeService::EncodeService(EncodeServiceSettings settings)
+  : m_isStopping{false}, m_inlineThreshold{settings.inlineThreshold},
+    m_chunkByteCount{settings.chunkByteCount}, m_nextWorker{0U},
+    m_queueDepth{0U}, m_submittedJobCount{0U}, m_inlineJobCount{0U},
+    m_completedJobCount{0U}, m_stolenChunkCount{0U}, m_totalLatencyNs{0U},
+    m_maxLatencyNs{0U} {
+  size_t workerCount = settings.workerCount;
+
+  if (workerCount == 0U) {
+    workerCount = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+
+  m_workers.reserve(workerCount);
+
+  for (size_t index = 0U; index < workerCount; ++index) {
+    m_workers.emplace_back(std::make_unique<Worker>());
+  }
+
+  m_threads.reserve(workerCount);
+
+  for (size_t index = 0U; index < workerCount; ++index) {
+    m_threads.emplace_back([this, index] { Run_(index); });
+  }
+}
+
+EncodeService::~EncodeService() noexcept {
+  {
+    std::lock_guard lock{m_waitMutex};
+
+    m_isStopping = true;
+  }
+
+  m_waitCondition.notify_all();
+
+  // The workers drain the queued chunks before they exit.
+  for (std::thread &thread : m_threads) {
+    thread.join();
+  }
+}
+
+EncodeService &EncodeService::Get() {
+  static EncodeService s_service{};
+
+  return s_service;
+}
+
+std::future<std::string> EncodeService::Submit(void const *dataHandle,
+                                               size_t elementCount,
+                                               size_t primitiveSize,
+                                               std::endian byteOrder) {
+  auto job = std::make_shared<Job>();
+
+  std::future<std::string> encodedData = job->promise.get_future();
+
+  Enqueue_(std::move(job), dataHandle, elementCount, primitiveSize, byteOrder);
+
+  return encodedData;
+}
+
+void EncodeService::Submit(void const *dataHandle, size_t elementCount,
+                           size_t primitiveSize, Callback_t callback,
+                           std::endian byteOrder) {
+  auto job = std::make_shared<Job>();
+
+  job->callback = std::move(callback);
+
+  Enqueue_(std::move(job), dataHandle, elementCount, primitiveSize, byteOrder);
+}
+
+void EncodeService::Enqueue_(std::shared_ptr<Job> job, void const *dataHandle,
+                             size_t elementCount, size_t primitiveSize,
+                             std::endian byteOrder) {
+  m_submittedJobCount.fetch_add(1U, std::memory_order_relaxed);
+
+  job->encodedData.resize(EncodedCharCountBase64(elementCount, primitiveSize));
+
+  const size_t byteCount = elementCount * primitiveSize;
+
+  if (byteCount == 0U ||
+      byteCount < m_inlineThreshold.load(std::memory_order_relaxed)) {
+    // A zero primitive size leaves the output empty, same as EncodeBase64.
+    [[maybe_unused]] const bool isEncoded =
+      EncodeBase64(dataHandle, elementCount, primitiveSize,
+                   std::span<char>{job->encodedData}, byteOrder);
+
+    m_inlineJobCount.fetch_add(1U, std::memory_order_relaxed);
+    m_completedJobCount.fetch_add(1U, std::memory_order_relaxed);
+
+    job->Deliver();
+
+    return;
+  }
+
+  const size_t blockByteCount = std::lcm(byteCountBase64, primitiveSize);
+  const size_t chunkElementCount =
+    std::max(m_chunkByteCount.load(std::memory_order_relaxed) / blockByteCount,
+             size_t{1U}) *
+    blockByteCount / primitiveSize;
+  const size_t chunkCount =
+    (elementCount + chunkElementCount - 1U) / chunkElementCount;
+
+  job->remainingChunkCount.store(chunkCount, std::memory_order_relaxed);
+  job->submitTime = std::chrono::steady_clock::now();
+
+  const size_t workerCount = std::size(m_workers);
+  const size_t firstWorker =
+    m_nextWorker.fetch_add(1U, std::memory_order_relaxed);
+
+  auto const *dataHandleU8 = static_cast<std::uint8_t const *>(dataHandle);
+
+  // Counted before the chunks are published, so a worker which pops one
+  // right away can't take the depth below zero.
+  m_queueDepth.fetch_add(chunkCount, std::memory_order_release);
+
+  for (size_t index = 0U; index < chunkCount; ++index) {
+    const size_t eIndex = index * chunkElementCount;
+
+    Chunk chunk{
+      .job = job,
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      .dataHandle = dataHandleU8 + eIndex * primitiveSize,
+      .elementCount = std::min(chunkElementCount, elementCount - eIndex),
+      .primitiveSize = primitiveSize,
+      .byteOrder = byteOrder,
+      .charOffset = EncodedCharCountBase64(eIndex, primitiveSize)};
+
+    Worker &worker = *m_workers[(firstWorker + index) % workerCount];
+
+    std::lock_guard lock{worker.mutex};
+
+    worker.chunks.emplace_back(std::move(chunk));
+  }
+
+  {
+    // Taking the lock makes sure a worker which is about to wait sees the new
+    // queue depth.
+    std::lock_guard lock{m_waitMutex};
+  }
+
+  m_waitCondition.notify_all();
+}
+
+void EncodeService::Run_(size_t workerIndex) noexcept {
+  while (true) {
+    Chunk chunk{};
+
+    if (PopChunk_(workerIndex, chunk)) {
+      ProcessChunk_(chunk);
+
+      continue;
+    }
+
+    std::unique_lock lock{m_waitMutex};
+
+    m_waitCondition.wait(lock, [this] {
+      return m_isStopping || m_queueDepth.load(std::memory_order_acquire) != 0U;
+    });
+
+    if (m_isStopping && m_queueDepth.load(std::memory_order_acquire) == 0U) {
+      return;
+    }
+  }
+}
+
+bool EncodeService::PopChunk_(size_t workerIndex, Chunk &chunk) noexcept {
+  const size_t workerCount = std::size(m_workers);
+
+  {
+    Worker &worker = *m_workers[workerIndex];
+
+    std::lock_guard lock{worker.mutex};
+
+    if (!std::empty(worker.chunks)) {
+      chunk = std::move(worker.chunks.back());
+
+      worker.chunks.pop_back();
+
+      m_queueDepth.fetch_sub(1U, std::memory_order_relaxed);
+
+      return true;
+    }
+  }
+
+  for (size_t offset = 1U; offset < workerCount; ++offset) {
+    Worker &victim = *m_workers[(workerIndex + offset) % workerCount];
+
+    std::lock_guard lock{victim.mutex};
+
+    if (!std::empty(victim.chunks)) {
+      chunk = std::move(victim.chunks.front());
+
+      victim.chunks.pop_front();
+
+      m_queueDepth.fetch_sub(1U, std::memory_order_relaxed);
+      m_stolenChunkCount.fetch_add(1U, std::memory_order_relaxed);
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void EncodeService::ProcessChunk_(const Chunk &chunk) noexcept {
+  Job &job = *chunk.job;
+
+  // Every chunk writes into its own part of the output.
+  [[maybe_unused]] const bool isEncoded = EncodeBase64(
+    chunk.dataHandle, chunk.elementCount, chunk.primitiveSize,
+    std::span<char>{job.encodedData}.subspan(chunk.charOffset),
+    chunk.byteOrder);
+
+  if (job.remainingChunkCount.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+    CompleteJob_(job);
+  }
+}
+
+void EncodeService::CompleteJob_(Job &job) noexcept {
+  const auto latencyNs = static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - job.submitTime)
+      .count());
+
+  m_totalLatencyNs.fetch_add(latencyNs, std::memory_order_relaxed);
+
+  std::uint64_t maxLatencyNs = m_maxLatencyNs.load(std::memory_order_relaxed);
+
+  while (maxLatencyNs < latencyNs &&
+         !m_maxLatencyNs.compare_exchange_weak(maxLatencyNs, latencyNs,
+                                               std::memory_order_relaxed)) {
+  }
+
+  m_completedJobCount.fetch_add(1U, std::memory_order_relaxed);
+
+  job.Deliver();
+}
+
+EncodeServiceStats EncodeService::GetStats() const noexcept {
+  const size_t completedJobCount =
+    m_completedJobCount.load(std::memory_order_relaxed);
+  const size_t inlineJobCount = m_inlineJobCount.load(std::memory_order_relaxed);
+  const size_t pooledJobCount =
+    completedJobCount > inlineJobCount ? completedJobCount - inlineJobCount
+                                       : 0U;
+
+  const std::uint64_t totalLatencyNs =
+    m_totalLatencyNs.load(std::memory_order_relaxed);
+  const std::uint64_t averageLatencyNs =
+    pooledJobCount == 0U ? 0U : totalLatencyNs / pooledJobCount;
+
+  using Rep_t = std::chrono::nanoseconds::rep;
+
+  return EncodeServiceStats{
+    .queueDepth = m_queueDepth.load(std::memory_order_relaxed),
+    .submittedJobCount = m_submittedJobCount.load(std::memory_order_relaxed),
+    .inlineJobCount = inlineJobCount,
+    .completedJobCount = completedJobCount,
+    .stolenChunkCount = m_stolenChunkCount.load(std::memory_order_relaxed),
+    .averageLatency =
+      std::chrono::nanoseconds{static_cast<Rep_t>(averageLatencyNs)},
+    .maxLatency = std::chrono::nanoseconds{
+      static_cast<Rep_t>(m_maxLatencyNs.load(std::memory_order_relaxed))}};
+}
+} // namespace Phobos
@@ -0,0 +1,103 @@
+#include <Base64EncodedView.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <span>
+
+namespace Phobos {
+Base64EncodedView::Base64EncodedView(void *dataHandle, size_t elementCount,
+                                     size_t primitiveSize,
+                                     std::endian byteOrder)
+  : m_dataHandle{dataHandle}, m_elementCount{elementCount},
+    m_primitiveSize{primitiveSize}, m_byteOrder{byteOrder},
+    m_byteCount{elementCount * primitiveSize},
+    m_blockByteCount{
+      std::lcm(byteCountBase64, std::max(primitiveSize, size_t{1U}))},
+    m_encodedData(EncodedCharCountBase64(elementCount, primitiveSize), '\0') {
+  // A zero primitive size leaves the text empty, same as EncodeBase64.
+  [[maybe_unused]] const bool isEncoded =
+    EncodeBase64(m_dataHandle, m_elementCount, m_primitiveSize,
+                 std::span<char>{m_encodedData}, m_byteOrder);
+}
+
+bool Base64EncodedView::Write(size_t byteOffset, void const *data,
+                              size_t byteCount) {
+  if (byteOffset > m_byteCount || byteCount > m_byteCount - byteOffset) {
+    return false;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  memcpy(static_cast<std::uint8_t *>(m_dataHandle) + byteOffset, data,
+         byteCount);
+
+  MarkDirty(byteOffset, byteCount);
+
+  return true;
+}
+
+void Base64EncodedView::MarkDirty(size_t byteOffset, size_t byteCount) {
+  if (byteOffset >= m_byteCount || byteCount == 0U) {
+    return;
+  }
+
+  const size_t byteEnd =
+    byteOffset + std::min(byteCount, m_byteCount - byteOffset);
+
+  size_t firstBlock = byteOffset / m_blockByteCount;
+  size_t lastBlock = (byteEnd + m_blockByteCount - 1U) / m_blockByteCount;
+
+  // The ranges are sorted and disjoint, so the ones which overlap or touch the
+  // new range are next to each other, starting at the first one which doesn't
+  // end before it.
+  auto mergeBegin = std::ranges::lower_bound(
+    m_dirtyBlocks, firstBlock, {}, &std::pair<size_t, size_t>::second);
+  auto mergeEnd =
+    std::find_if(mergeBegin, std::end(m_dirtyBlocks),
+                 [lastBlock](const std::pair<size_t, size_t> &dirtyBlocks) {
+                   return dirtyBlocks.first > lastBlock;
+                 });
+
+  if (mergeBegin != mergeEnd) {
+    firstBlock = std::min(firstBlock, mergeBegin->first);
+    lastBlock = std::max(lastBlock, std::prev(mergeEnd)->second);
+  }
+
+  m_dirtyBlocks.emplace(m_dirtyBlocks.erase(mergeBegin, mergeEnd), firstBlock,
+                        lastBlock);
+}
+
+void Base64EncodedView::Flush() noexcept {
+  // The ranges were merged when they were marked, so every block is only
+  // encoded once.
+  for (const auto &[firstBlock, lastBlock] : m_dirtyBlocks) {
+    EncodeBlocks_(firstBlock, lastBlock);
+  }
+
+  m_dirtyBlocks.clear();
+}
+
+void Base64EncodedView::EncodeBlocks_(size_t firstBlock,
+                                      size_t lastBlock) noexcept {
+  if (firstBlock >= lastBlock) {
+    return;
+  }
+
+  const size_t byteBegin = firstBlock * m_blockByteCount;
+  const size_t byteEnd = std::min(lastBlock * m_blockByteCount, m_byteCount);
+
+  const size_t elementCount = (byteEnd - byteBegin) / m_primitiveSize;
+
+  // Blocks are encoded into full units, so the characters of a block start at
+  // a fixed offset. Only the last block can have padding, which is the same
+  // padding the whole buffer would have.
+  const size_t charBegin = byteBegin / byteCountBase64 * charCountBase64;
+
+  [[maybe_unused]] const bool isEncoded = EncodeBase64(
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    static_cast<std::uint8_t const *>(m_dataHandle) + byteBegin, elementCount,
+    m_primitiveSize, std::span<char>{m_encodedData}.subspan(charBegin),
+    m_byteOrder);
+}
+} // namespace Phobos
@@ -1,18 +1,41 @@
 #include <Base64Encoder.hpp>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
 #include <type_traits>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#include <xmmintrin.h>
+#define PHOBOS_HAS_STREAMING_STORES 1
+#else
+#define PHOBOS_HAS_STREAMING_STORES 0
+#endif
+
 namespace Phobos {
-static constexpr std::array s_characterMap{
-  'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
-  'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
-  'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
-  'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z',
-  '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'};
+static constexpr const auto &s_characterMap = characterMapBase64;
 
 static constexpr std::array s_6bitsOffsetMap{23, 17, 11, 5};
 
+static constexpr size_t s_oneByte = 1U;
+static constexpr size_t s_twoBytes = 2U;
+static constexpr size_t s_fourBytes = 4U;
+static constexpr size_t s_eightBytes = 8U;
+static constexpr size_t s_sixteenBytes = 16U;
+// The characters are a third larger than the bytes.
+static constexpr size_t s_maxByteCount =
+  std::numeric_limits<size_t>::max() / charCountBase64 * byteCountBase64;
+
+static constexpr size_t s_cacheLineSize = 64U;
+// 4KB of characters for 3KB of bytes.
+static constexpr size_t s_stagingCharCount = 4096U;
+
+static std::atomic<size_t> s_streamingThreshold{
+  defaultStreamingThresholdBase64};
+
 struct MemcpyDetails {
   std::uint32_t offset1;
   std::uint32_t size1;
@@ -85,7 +108,7 @@ char Encoder24Bits::Encode6bits_(size_t index) const noexcept {
 }
 
 char Encoder24Bits::Encode6bitsWithCheck_(size_t index) const noexcept {
-  char encodedChar = '=';
+  char encodedChar = paddingCharBase64;
 
   // The parameter index is the index of the 6bit segments in the 24bits.
   // We store the data in the multiples of 8bits.
@@ -330,167 +353,312 @@ std::string Encoder64Bits::EncodeStrWithCheck() const noexcept {
 }
 
 namespace {
-template <typename T>
-concept UInt32OR64 = Plus24Bits_t<T> && requires(T) {
-  std::is_same_v<T, std::uint32_t> || std::is_same_v<T, std::uint64_t>;
-};
+template <size_t primitiveSize, Base64Char_t Char_t>
+void EncodeElements(void const *dataHandle, size_t elementCount,
+                    std::endian byteOrder, Char_t *encodedData) {
+  if (byteOrder == std::endian::native) {
+    Detail::EncodeElements<primitiveSize, std::endian::native>(
+      dataHandle, elementCount, encodedData);
+  } else if (byteOrder == std::endian::little) {
+    Detail::EncodeElements<primitiveSize, std::endian::little>(
+      dataHandle, elementCount, encodedData);
+  } else {
+    Detail::EncodeElements<primitiveSize, std::endian::big>(
+      dataHandle, elementCount, encodedData);
+  }
+}
 
-template <UInt32OR64 T>
-struct Encoder32BitsPlus {
-  using type = Encoder32Bits;
-};
+// The elements must be valid.
+template <Base64Char_t Char_t>
+void EncodeSupportedElements(void const *dataHandle, size_t elementCount,
+                             size_t primitiveSize, std::endian byteOrder,
+                             Char_t *encodedData) {
+  if (primitiveSize == s_oneByte) {
+    Detail::EncodeBytes(dataHandle, elementCount, encodedData);
+  } else if (primitiveSize == s_twoBytes) {
+    EncodeElements<s_twoBytes>(dataHandle, elementCount, byteOrder,
+                               encodedData);
+  } else if (primitiveSize == s_fourBytes) {
+    EncodeElements<s_fourBytes>(dataHandle, elementCount, byteOrder,
+                                encodedData);
+  } else if (primitiveSize == s_eightBytes) {
+    EncodeElements<s_eightBytes>(dataHandle, elementCount, byteOrder,
+                                 encodedData);
+  } else if (primitiveSize == s_sixteenBytes) {
+    EncodeElements<s_sixteenBytes>(dataHandle, elementCount, byteOrder,
+                                   encodedData);
+  } else if (byteOrder == std::endian::native) {
+    Detail::EncodeBytes(dataHandle, elementCount * primitiveSize, encodedData);
+  } else {
+    Detail::EncodeReversedElements(dataHandle, elementCount, primitiveSize,
+                                   encodedData);
+  }
+}
 
-template <>
-struct Encoder32BitsPlus<std::uint64_t> {
-  using type = Encoder64Bits;
-};
+template <Base64Char_t Char_t>
+[[nodiscard]]
+bool EncodeBase64As(void const *dataHandle, size_t elementCount,
+                    size_t primitiveSize, std::span<Char_t> encodedData,
+                    std::endian byteOrder) noexcept {
+  if (!AreElementsValidBase64(elementCount, primitiveSize) ||
+      std::size(encodedData) <
+        EncodedCharCountBase64(elementCount, primitiveSize)) {
+    return false;
+  }
 
-template <UInt32OR64 T>
-void Encode32BitsPlus(std::vector<char> &encodedData, void const *dataHandleV,
-                      size_t elementCount) {
-  constexpr bool is64Bits = std::is_same_v<T, std::uint64_t>;
-  static constexpr size_t charCount =
-    is64Bits ? Encoder64Bits::charCount : charCountBase64;
+  EncodeSupportedElements(dataHandle, elementCount, primitiveSize, byteOrder,
+                          std::data(encodedData));
 
-  auto const *dataHandle = static_cast<T const *>(dataHandleV);
+  return true;
+}
 
-  size_t eIndex = 0U;
-  size_t cIndex = 0U;
+template <typename String_t>
+[[nodiscard]]
+String_t EncodeBase64StrAs(void const *dataHandle, size_t elementCount,
+                           size_t primitiveSize,
+                           std::endian byteOrder) noexcept {
+  if (!AreElementsValidBase64(elementCount, primitiveSize)) {
+    return {};
+  }
 
-  typename Encoder32BitsPlus<T>::type encoder{};
+  String_t encodedData(EncodedCharCountBase64(elementCount, primitiveSize),
+                       typename String_t::value_type{});
 
-  for (; eIndex < elementCount;) {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    const bool isLoaded = encoder.LoadData(*(dataHandle + eIndex));
+  [[maybe_unused]] const bool isEncoded =
+    EncodeBase64As(dataHandle, elementCount, primitiveSize,
+                   std::span{encodedData}, byteOrder);
 
-    const std::array<char, charCount> encodedChars{encoder.Encode()};
+  return encodedData;
+}
 
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    memcpy(std::data(encodedData) + cIndex, std::data(encodedChars), charCount);
+// Copies the characters with non-temporal stores where the target has them, so
+// they go to memory without being read into the caches first. The unaligned
+// head and the tail use normal stores.
+void StreamCharacters(char *destination, char const *source,
+                      size_t charCount) noexcept {
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+#if PHOBOS_HAS_STREAMING_STORES
+  constexpr size_t vectorSize = sizeof(__m128i);
+
+  const size_t headCount = std::min(
+    (vectorSize - reinterpret_cast<std::uintptr_t>(destination) % vectorSize) %
+      vectorSize,
+    charCount);
+
+  memcpy(destination, source, headCount);
+
+  size_t index = headCount;
+
+  for (; index + vectorSize <= charCount; index += vectorSize) {
+    // NOLINTBEGIN(*-type-reinterpret-cast)
+    _mm_stream_si128(reinterpret_cast<__m128i *>(destination + index),
+                     _mm_loadu_si128(
+                       reinterpret_cast<__m128i const *>(source + index)));
+    // NOLINTEND(*-type-reinterpret-cast)
+  }
 
-    cIndex += charCount;
+  memcpy(destination + index, source + index, charCount - index);
+#else
+  memcpy(destination, source, charCount);
+#endif
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
 
-    if (isLoaded) {
-      ++eIndex;
-    }
+void PrefetchBytes([[maybe_unused]] std::uint8_t const *data,
+                   [[maybe_unused]] size_t byteCount) noexcept {
+#if PHOBOS_HAS_STREAMING_STORES
+  for (size_t index = 0U; index < byteCount; index += s_cacheLineSize) {
+    // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic, *-type-reinterpret-cast)
+    _mm_prefetch(reinterpret_cast<char const *>(data + index), _MM_HINT_NTA);
+    // NOLINTEND(*-pro-bounds-pointer-arithmetic, *-type-reinterpret-cast)
   }
+#endif
+}
 
-  {
-    encoder.LoadData(0U, 0U);
-
-    const std::array<char, charCount> encoded24Bits{encoder.EncodeWithCheck()};
+// Encodes a chunk at a time into a staging buffer which stays in the L1 cache
+// and streams it out, while the next chunk of the input is prefetched. The
+// chunk is a multiple of LCM(3, primitiveSize) bytes, so only the last one has
+// padding. Elements too wide for a chunk are encoded in place.
+void EncodeStreaming(void const *dataHandle, size_t elementCount,
+                     size_t primitiveSize, std::endian byteOrder,
+                     char *encodedData) {
+  constexpr size_t stagingByteCount =
+    s_stagingCharCount / charCountBase64 * byteCountBase64;
+
+  const size_t blockByteCount = std::lcm(byteCountBase64, primitiveSize);
+  const size_t chunkByteCount =
+    stagingByteCount / blockByteCount * blockByteCount;
+
+  if (chunkByteCount == 0U) {
+    EncodeSupportedElements(dataHandle, elementCount, primitiveSize, byteOrder,
+                            encodedData);
+
+    return;
+  }
 
-    size_t remainingByteCount = charCount;
+  alignas(s_cacheLineSize) std::array<char, s_stagingCharCount> stagingData{};
 
-    if constexpr (is64Bits) {
-      if (!encoder.AreLast4CharactersValid()) {
-        remainingByteCount = charCountBase64;
-      }
-    }
+  auto const *dataHandleU8 = static_cast<std::uint8_t const *>(dataHandle);
 
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    memcpy(std::data(encodedData) + cIndex, std::data(encoded24Bits),
-           remainingByteCount);
-  }
-}
-} // namespace
+  const size_t byteCount = elementCount * primitiveSize;
 
-std::vector<char> EncodeBase64(void const *dataHandle, size_t elementCount,
-                               size_t primitiveSize) noexcept {
-  constexpr size_t oneByte = 1U;
-  constexpr size_t twoBytes = 2U;
-  constexpr size_t fourBytes = 4U;
-  constexpr size_t eightBytes = 8U;
+  size_t cIndex = 0U;
 
-  const size_t encodedUnitCount =
-    ((elementCount * primitiveSize + 2U) / byteCountBase64) * charCountBase64;
+  for (size_t bIndex = 0U; bIndex < byteCount; bIndex += chunkByteCount) {
+    const size_t chunkSize = std::min(chunkByteCount, byteCount - bIndex);
+    const size_t nextChunkIndex = bIndex + chunkSize;
 
-  std::vector<char> encodedData(encodedUnitCount, '\0');
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    PrefetchBytes(dataHandleU8 + nextChunkIndex,
+                  std::min(chunkByteCount, byteCount - nextChunkIndex));
 
-  if (primitiveSize == oneByte) {
-    constexpr size_t invalidByteCount = byteCountBase64 - oneByte;
+    EncodeSupportedElements(dataHandleU8 + bIndex, chunkSize / primitiveSize,
+                            primitiveSize, byteOrder, std::data(stagingData));
 
-    auto const *dataHandleU8 = static_cast<std::uint8_t const *>(dataHandle);
+    const size_t charCount = EncodedCharCountBase64(chunkSize, 1U);
 
-    size_t eIndex = 0U;
-    size_t cIndex = 0U;
+    StreamCharacters(encodedData + cIndex, std::data(stagingData), charCount);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-    Encoder24Bits encoder{};
+    cIndex += charCount;
+  }
 
-    for (; eIndex + invalidByteCount < elementCount;
-         eIndex += byteCountBase64) {
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      encoder.LoadData(dataHandleU8 + eIndex, byteCountBase64);
+#if PHOBOS_HAS_STREAMING_STORES
+  // The non-temporal stores aren't ordered with the other stores, so they must
+  // be visible before the output is handed to another thread.
+  _mm_sfence();
+#endif
+}
+} // namespace
 
-      const std::array<char, charCountBase64> encoded24Bits{encoder.Encode()};
+bool AreElementsValidBase64(size_t elementCount,
+                            size_t primitiveSize) noexcept {
+  // Any element width works, but the byte count and the character count must
+  // fit in a size_t.
+  return primitiveSize != 0U &&
+         elementCount <= s_maxByteCount / primitiveSize;
+}
 
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      memcpy(std::data(encodedData) + cIndex, std::data(encoded24Bits),
-             charCountBase64);
+void SetStreamingThresholdBase64(size_t byteCount) noexcept {
+  s_streamingThreshold.store(byteCount, std::memory_order_relaxed);
+}
 
-      cIndex += charCountBase64;
-    }
+size_t GetStreamingThresholdBase64() noexcept {
+  return s_streamingThreshold.load(std::memory_order_relaxed);
+}
 
-    if (eIndex < elementCount) {
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      encoder.LoadData(dataHandleU8 + eIndex, elementCount - eIndex);
+bool Detail::EncodeBase64InMode(void const *dataHandle, size_t elementCount,
+                                size_t primitiveSize,
+                                std::span<char> encodedData,
+                                std::endian byteOrder,
+                                bool isStreaming) noexcept {
+  if (!AreElementsValidBase64(elementCount, primitiveSize) ||
+      std::size(encodedData) <
+        EncodedCharCountBase64(elementCount, primitiveSize)) {
+    return false;
+  }
 
-      const std::array<char, charCountBase64> encoded24Bits{
-        encoder.EncodeWithCheck()};
+  if (isStreaming) {
+    EncodeStreaming(dataHandle, elementCount, primitiveSize, byteOrder,
+                    std::data(encodedData));
+  } else {
+    EncodeSupportedElements(dataHandle, elementCount, primitiveSize, byteOrder,
+                            std::data(encodedData));
+  }
 
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      memcpy(std::data(encodedData) + cIndex, std::data(encoded24Bits),
-             charCountBase64);
-    }
-  } else if (primitiveSize == twoBytes) {
-    constexpr size_t invalidByteCount = byteCountBase64 - twoBytes;
+  return true;
+}
 
-    auto const *dataHandleU16 = static_cast<std::uint16_t const *>(dataHandle);
+bool EncodeBase64(void const *dataHandle, size_t elementCount,
+                  size_t primitiveSize, std::span<char> encodedData,
+                  std::endian byteOrder) noexcept {
+  const size_t streamingThreshold = GetStreamingThresholdBase64();
 
-    size_t eIndex = 0U;
-    size_t cIndex = 0U;
+  // The overflowing counts are rejected by the encode.
+  const bool isStreaming =
+    streamingThreshold != 0U &&
+    AreElementsValidBase64(elementCount, primitiveSize) &&
+    elementCount * primitiveSize >= streamingThreshold;
 
-    Encoder16Bits encoder{};
+  return Detail::EncodeBase64InMode(dataHandle, elementCount, primitiveSize,
+                                    encodedData, byteOrder, isStreaming);
+}
 
-    for (; eIndex + invalidByteCount < elementCount;) {
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      const size_t loadedElement = encoder.LoadData(dataHandleU16 + eIndex, 2U);
+std::vector<char> EncodeBase64(void const *dataHandle, size_t elementCount,
+                               size_t primitiveSize,
+                               std::endian byteOrder) noexcept {
+  if (!AreElementsValidBase64(elementCount, primitiveSize)) {
+    return {};
+  }
 
-      const std::array<char, charCountBase64> encoded24Bits = encoder.Encode();
+  std::vector<char> encodedData(
+    EncodedCharCountBase64(elementCount, primitiveSize), '\0');
 
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      memcpy(std::data(encodedData) + cIndex, std::data(encoded24Bits),
-             charCountBase64);
+  [[maybe_unused]] const bool isEncoded = EncodeBase64(
+    dataHandle, elementCount, primitiveSize, encodedData, byteOrder);
 
-      cIndex += charCountBase64;
-      eIndex += loadedElement;
-    }
+  return encodedData;
+}
 
-    {
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      encoder.LoadData(dataHandleU16 + eIndex, elementCount - eIndex);
+std::string EncodeBase64Str(void const *dataHandle, size_t elementCount,
+                            size_t primitiveSize,
+                            std::endian byteOrder) noexcept {
+  if (!AreElementsValidBase64(elementCount, primitiveSize)) {
+    return {};
+  }
 
-      const std::array<char, charCountBase64> encoded24Bits{
-        encoder.EncodeWithCheck()};
+  std::string encodedData(EncodedCharCountBase64(elementCount, primitiveSize),
+                          '\0');
 
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      memcpy(std::data(encodedData) + cIndex, std::data(encoded24Bits),
-             charCountBase64);
-    }
-  } else if (primitiveSize == fourBytes) {
-    Encode32BitsPlus<std::uint32_t>(encodedData, dataHandle, elementCount);
-  } else if (primitiveSize == eightBytes) {
-    Encode32BitsPlus<std::uint64_t>(encodedData, dataHandle, elementCount);
-  }
+  [[maybe_unused]] const bool isEncoded = EncodeBase64(
+    dataHandle, elementCount, primitiveSize, encodedData, byteOrder);
 
   return encodedData;
 }
 
-std::string EncodeBase64Str(void const *dataHandle, size_t elementCount,
-                            size_t primitiveSize) noexcept {
-  const std::vector<char> encodedData =
-    EncodeBase64(dataHandle, elementCount, primitiveSize);
+bool EncodeBase64(void const *dataHandle, size_t elementCount,
+                  size_t primitiveSize, std::span<char8_t> encodedData,
+                  std::endian byteOrder) noexcept {
+  return EncodeBase64As(dataHandle, elementCount, primitiveSize, encodedData,
+                        byteOrder);
+}
+
+bool EncodeBase64(void const *dataHandle, size_t elementCount,
+                  size_t primitiveSize, std::span<char16_t> encodedData,
+                  std::endian byteOrder) noexcept {
+  return EncodeBase64As(dataHandle, elementCount, primitiveSize, encodedData,
+                        byteOrder);
+}
+
+std::u8string EncodeBase64U8Str(void const *dataHandle, size_t elementCount,
+                                size_t primitiveSize,
+                                std::endian byteOrder) noexcept {
+  return EncodeBase64StrAs<std::u8string>(dataHandle, elementCount,
+                                          primitiveSize, byteOrder);
+}
+
+std::u16string EncodeBase64U16Str(void const *dataHandle, size_t elementCount,
+                                  size_t primitiveSize,
+                                  std::endian byteOrder) noexcept {
+  return EncodeBase64StrAs<std::u16string>(dataHandle, elementCount,
+                                           primitiveSize, byteOrder);
+}
+
+std::pmr::vector<char> EncodeBase64(void const *dataHandle,
+                                    size_t elementCount, size_t primitiveSize,
+                                    std::pmr::memory_resource *memoryResource,
+                                    std::endian byteOrder) {
+  return EncodeBase64(dataHandle, elementCount, primitiveSize,
+                      std::pmr::polymorphic_allocator<char>{memoryResource},
+                      byteOrder);
+}
 
-  return std::string{std::begin(encodedData), std::end(encodedData)};
+std::pmr::string EncodeBase64Str(void const *dataHandle, size_t elementCount,
+                                 size_t primitiveSize,
+                                 std::pmr::memory_resource *memoryResource,
+                                 std::endian byteOrder) {
+  return EncodeBase64Str(dataHandle, elementCount, primitiveSize,
+                         std::pmr::polymorphic_allocator<char>{memoryResource},
+                         byteOrder);
 }
 } // namespace Phobos
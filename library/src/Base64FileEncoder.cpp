@@ -0,0 +1,252 @@
+#include <Base64Encoder.hpp>
+#include <Base64FileEncoder.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Phobos {
+namespace {
+using Clock_t = std::chrono::steady_clock;
+
+enum class BufferState : std::uint8_t { Free, Read, Encoded };
+
+struct PipelineBuffer {
+  std::vector<std::uint8_t> inputData;
+  std::vector<char> outputData;
+  size_t byteCount{0U};
+  BufferState state{BufferState::Free};
+};
+
+// The buffer of the chunk i is i % bufferCount, and every stage goes through
+// the chunks in order, so a stage only has to wait for the state of its next
+// buffer.
+class FilePipeline {
+public:
+  FilePipeline(const FileEncodeSettings &settings, size_t bufferByteCount,
+               size_t byteCount)
+    : m_settings{settings}, m_bufferByteCount{bufferByteCount},
+      m_byteCount{byteCount},
+      m_chunkCount{(byteCount + bufferByteCount - 1U) / bufferByteCount},
+      m_buffers(settings.bufferCount), m_isFailed{false} {
+    for (PipelineBuffer &buffer : m_buffers) {
+      buffer.inputData.resize(bufferByteCount);
+      buffer.outputData.resize(EncodedCharCountBase64(bufferByteCount, 1U));
+    }
+  }
+
+  void Read(std::ifstream &inputFile) noexcept {
+    for (size_t chunkIndex = 0U; chunkIndex < m_chunkCount; ++chunkIndex) {
+      PipelineBuffer *buffer = WaitFor_(chunkIndex, BufferState::Free);
+
+      if (buffer == nullptr) {
+        return;
+      }
+
+      const auto startTime = Clock_t::now();
+
+      const size_t byteCount = std::min(
+        m_bufferByteCount, m_byteCount - chunkIndex * m_bufferByteCount);
+
+      inputFile.read(
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        reinterpret_cast<char *>(std::data(buffer->inputData)),
+        static_cast<std::streamsize>(byteCount));
+
+      m_readTime += Clock_t::now() - startTime;
+
+      if (static_cast<size_t>(inputFile.gcount()) != byteCount) {
+        Fail_();
+
+        return;
+      }
+
+      buffer->byteCount = byteCount;
+
+      SetState_(*buffer, BufferState::Read);
+    }
+  }
+
+  void Encode() noexcept {
+    for (size_t chunkIndex = 0U; chunkIndex < m_chunkCount; ++chunkIndex) {
+      PipelineBuffer *buffer = WaitFor_(chunkIndex, BufferState::Read);
+
+      if (buffer == nullptr) {
+        return;
+      }
+
+      const auto startTime = Clock_t::now();
+
+      [[maybe_unused]] const bool isEncoded = EncodeBase64(
+        std::data(buffer->inputData),
+        buffer->byteCount / m_settings.primitiveSize, m_settings.primitiveSize,
+        std::span<char>{buffer->outputData}, m_settings.byteOrder);
+
+      m_encodeTime += Clock_t::now() - startTime;
+
+      SetState_(*buffer, BufferState::Encoded);
+    }
+  }
+
+  void Write(std::ofstream &outputFile) noexcept {
+    for (size_t chunkIndex = 0U; chunkIndex < m_chunkCount; ++chunkIndex) {
+      PipelineBuffer *buffer = WaitFor_(chunkIndex, BufferState::Encoded);
+
+      if (buffer == nullptr) {
+        return;
+      }
+
+      const auto startTime = Clock_t::now();
+
+      outputFile.write(std::data(buffer->outputData),
+                       static_cast<std::streamsize>(
+                         EncodedCharCountBase64(buffer->byteCount, 1U)));
+
+      if (chunkIndex + 1U == m_chunkCount) {
+        outputFile.flush();
+      }
+
+      m_writeTime += Clock_t::now() - startTime;
+
+      if (!outputFile) {
+        Fail_();
+
+        return;
+      }
+
+      SetState_(*buffer, BufferState::Free);
+    }
+  }
+
+  [[nodiscard]]
+  bool IsFailed() const noexcept {
+    std::lock_guard lock{m_mutex};
+
+    return m_isFailed;
+  }
+
+  [[nodiscard]]
+  FileEncodeStats GetStats(Clock_t::duration totalTime) const noexcept {
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    return FileEncodeStats{
+      .byteCount = m_byteCount,
+      .charCount = EncodedCharCountBase64(m_byteCount, 1U),
+      .chunkCount = m_chunkCount,
+      .readTime = duration_cast<nanoseconds>(m_readTime),
+      .encodeTime = duration_cast<nanoseconds>(m_encodeTime),
+      .writeTime = duration_cast<nanoseconds>(m_writeTime),
+      .totalTime = duration_cast<nanoseconds>(totalTime)};
+  }
+
+private:
+  // Returns nullptr if another stage failed.
+  [[nodiscard]]
+  PipelineBuffer *WaitFor_(size_t chunkIndex, BufferState state) noexcept {
+    PipelineBuffer &buffer = m_buffers[chunkIndex % std::size(m_buffers)];
+
+    std::unique_lock lock{m_mutex};
+
+    m_stateCondition.wait(lock, [this, &buffer, state] {
+      return m_isFailed || buffer.state == state;
+    });
+
+    return m_isFailed ? nullptr : &buffer;
+  }
+
+  void SetState_(PipelineBuffer &buffer, BufferState state) noexcept {
+    {
+      std::lock_guard lock{m_mutex};
+
+      buffer.state = state;
+    }
+
+    m_stateCondition.notify_all();
+  }
+
+  void Fail_() noexcept {
+    {
+      std::lock_guard lock{m_mutex};
+
+      m_isFailed = true;
+    }
+
+    m_stateCondition.notify_all();
+  }
+
+private:
+  FileEncodeSettings m_settings;
+  size_t m_bufferByteCount;
+  size_t m_byteCount;
+  size_t m_chunkCount;
+  std::vector<PipelineBuffer> m_buffers;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_stateCondition;
+  bool m_isFailed;
+
+  // Each of them is only touched by its own stage.
+  Clock_t::duration m_readTime{};
+  Clock_t::duration m_encodeTime{};
+  Clock_t::duration m_writeTime{};
+};
+} // namespace
+
+std::optional<FileEncodeStats>
+EncodeFileBase64(const std::filesystem::path &inputPath,
+                 const std::filesystem::path &outputPath,
+                 const FileEncodeSettings &settings) {
+  const size_t primitiveSize = settings.primitiveSize;
+
+  if (primitiveSize == 0U || settings.bufferCount < 2U) {
+    return std::nullopt;
+  }
+
+  const size_t blockByteCount = std::lcm(byteCountBase64, primitiveSize);
+  const size_t bufferByteCount =
+    settings.bufferByteCount / blockByteCount * blockByteCount;
+
+  std::error_code errorCode{};
+
+  const auto fileSize = std::filesystem::file_size(inputPath, errorCode);
+
+  if (errorCode || bufferByteCount == 0U || fileSize % primitiveSize != 0U ||
+      !AreElementsValidBase64(static_cast<size_t>(fileSize) / primitiveSize,
+                              primitiveSize)) {
+    return std::nullopt;
+  }
+
+  std::ifstream inputFile{inputPath, std::ios::binary};
+  std::ofstream outputFile{outputPath, std::ios::binary | std::ios::trunc};
+
+  if (!inputFile || !outputFile) {
+    return std::nullopt;
+  }
+
+  const auto startTime = Clock_t::now();
+
+  FilePipeline pipeline{settings, bufferByteCount,
+                        static_cast<size_t>(fileSize)};
+
+  std::thread reader{[&pipeline, &inputFile] { pipeline.Read(inputFile); }};
+  std::thread writer{[&pipeline, &outputFile] { pipeline.Write(outputFile); }};
+
+  pipeline.Encode();
+
+  reader.join();
+  writer.join();
+
+  if (pipeline.IsFailed()) {
+    return std::nullopt;
+  }
+
+  return pipeline.GetStats(Clock_t::now() - startTime);
+}
+} // namespace Phobos
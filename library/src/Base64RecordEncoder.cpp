@@ -0,0 +1,146 @@
+#include <Base64Encoder.hpp>
+#include <Base64RecordEncoder.hpp>
+#include <array>
+#include <limits>
+
+namespace Phobos {
+namespace {
+// Returns an empty map if any of the fields is invalid.
+[[nodiscard]]
+std::vector<std::uint32_t>
+MakeByteMap(size_t recordByteCount, std::span<RecordFieldBase64 const> fields) {
+  std::vector<std::uint32_t> byteMap{};
+
+  if (recordByteCount > std::numeric_limits<std::uint32_t>::max()) {
+    return byteMap;
+  }
+
+  for (const RecordFieldBase64 &field : fields) {
+    const size_t primitiveSize = field.primitiveSize;
+
+    if (primitiveSize == 0U ||
+        field.offset > recordByteCount ||
+        field.elementCount > (recordByteCount - field.offset) / primitiveSize) {
+      return {};
+    }
+
+    const bool isSwapped = field.byteOrder != std::endian::native;
+
+    for (size_t eIndex = 0U; eIndex < field.elementCount; ++eIndex) {
+      const size_t elementOffset = field.offset + eIndex * primitiveSize;
+
+      for (size_t index = 0U; index < primitiveSize; ++index) {
+        const size_t byteIndex =
+          isSwapped ? primitiveSize - 1U - index : index;
+
+        byteMap.emplace_back(
+          static_cast<std::uint32_t>(elementOffset + byteIndex));
+      }
+    }
+  }
+
+  return byteMap;
+}
+
+[[nodiscard]]
+bool IsRawRecord(size_t recordByteCount,
+                 const std::vector<std::uint32_t> &byteMap) noexcept {
+  if (std::size(byteMap) != recordByteCount) {
+    return false;
+  }
+
+  for (size_t index = 0U; index < recordByteCount; ++index) {
+    if (byteMap[index] != index) {
+      return false;
+    }
+  }
+
+  return true;
+}
+} // namespace
+
+RecordEncoder::RecordEncoder(size_t recordByteCount,
+                             std::span<RecordFieldBase64 const> fields)
+  : m_recordByteCount{recordByteCount},
+    m_byteMap{MakeByteMap(recordByteCount, fields)},
+    m_isRawRecord{IsRawRecord(recordByteCount, m_byteMap)} {}
+
+size_t RecordEncoder::GetEncodedCharCount(size_t recordCount) const noexcept {
+  if (!AreElementsValidBase64(recordCount, std::size(m_byteMap))) {
+    return 0U;
+  }
+
+  return EncodedCharCountBase64(recordCount, std::size(m_byteMap));
+}
+
+bool RecordEncoder::Encode(void const *recordHandle, size_t recordCount,
+                           std::span<char> encodedData) const noexcept {
+  // An invalid schema has an empty byte map, which isn't valid either.
+  if (!AreElementsValidBase64(recordCount, std::size(m_byteMap)) ||
+      std::size(encodedData) < GetEncodedCharCount(recordCount)) {
+    return false;
+  }
+
+  if (m_isRawRecord) {
+    Detail::EncodeBytes(recordHandle, recordCount * m_recordByteCount,
+                        std::data(encodedData));
+
+    return true;
+  }
+
+  auto const *recordHandleU8 = static_cast<std::uint8_t const *>(recordHandle);
+
+  // The units can span across the records, so the bytes are accumulated
+  // until there are 3 of them.
+  std::uint32_t unitValue = 0U;
+  size_t unitByteCount = 0U;
+  size_t cIndex = 0U;
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (size_t rIndex = 0U; rIndex < recordCount; ++rIndex) {
+    std::uint8_t const *record = recordHandleU8 + rIndex * m_recordByteCount;
+
+    for (const std::uint32_t byteOffset : m_byteMap) {
+      unitValue = (unitValue << bitsInByte) | record[byteOffset];
+      ++unitByteCount;
+
+      if (unitByteCount == byteCountBase64) {
+        Detail::EncodeUnit(unitValue, std::data(encodedData) + cIndex);
+
+        cIndex += charCountBase64;
+        unitValue = 0U;
+        unitByteCount = 0U;
+      }
+    }
+  }
+
+  if (unitByteCount != 0U) {
+    std::array<std::uint8_t, byteCountBase64> tailData{};
+
+    for (size_t index = unitByteCount; index > 0U; --index) {
+      tailData.at(index - 1U) = static_cast<std::uint8_t>(unitValue);
+      unitValue >>= bitsInByte;
+    }
+
+    Detail::EncodeTail(std::data(tailData), unitByteCount,
+                       std::data(encodedData) + cIndex);
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  return true;
+}
+
+std::string RecordEncoder::EncodeStr(void const *recordHandle,
+                                     size_t recordCount) const {
+  if (!AreElementsValidBase64(recordCount, std::size(m_byteMap))) {
+    return {};
+  }
+
+  std::string encodedData(GetEncodedCharCount(recordCount), '\0');
+
+  [[maybe_unused]] const bool isEncoded =
+    Encode(recordHandle, recordCount, encodedData);
+
+  return encodedData;
+}
+} // namespace Phobos
@@ -0,0 +1,214 @@
+#include <Base64Decoder.hpp>
+#include <Base64Encoder.hpp>
+#include <Base64Transcoder.hpp>
+#include <array>
+#include <cstdint>
+
+namespace Phobos {
+static constexpr size_t s_hexCharCountPerByte = 2U;
+// 3 bytes, 6 hex digits.
+static constexpr size_t s_hexCharCountPerUnit =
+  byteCountBase64 * s_hexCharCountPerByte;
+static constexpr size_t s_bitCountHexChar = 4U;
+static constexpr std::uint32_t s_lower4BitsMask = 0xFU;
+static constexpr std::uint8_t s_invalidHexValue = 0xFFU;
+
+static constexpr std::array s_hexDigits{'0', '1', '2', '3', '4', '5', '6', '7',
+                                        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+static constexpr std::array s_upperHexDigits{'0', '1', '2', '3', '4', '5',
+                                             '6', '7', '8', '9', 'A', 'B',
+                                             'C', 'D', 'E', 'F'};
+
+namespace {
+[[nodiscard]]
+consteval std::array<std::uint8_t, decodeMapSizeBase64> MakeHexDecodeMap() {
+  std::array<std::uint8_t, decodeMapSizeBase64> decodeMap{};
+
+  decodeMap.fill(s_invalidHexValue);
+
+  for (size_t index = 0U; index < std::size(s_hexDigits); ++index) {
+    decodeMap.at(static_cast<unsigned char>(s_hexDigits.at(index))) =
+      static_cast<std::uint8_t>(index);
+    decodeMap.at(static_cast<unsigned char>(s_upperHexDigits.at(index))) =
+      static_cast<std::uint8_t>(index);
+  }
+
+  return decodeMap;
+}
+
+constexpr std::array s_hexDecodeMap{MakeHexDecodeMap()};
+
+// Writes the 2 hex digits of each of the bytes.
+void WriteHexDigits(std::uint8_t const *data, size_t byteCount,
+                    const decltype(s_hexDigits) &hexDigits,
+                    char *hexData) noexcept {
+  // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+  for (size_t index = 0U; index < byteCount; ++index) {
+    hexData[index * s_hexCharCountPerByte] =
+      hexDigits[data[index] >> s_bitCountHexChar];
+    hexData[index * s_hexCharCountPerByte + 1U] =
+      hexDigits[data[index] & s_lower4BitsMask];
+  }
+  // NOLINTEND(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+}
+
+// Reads digitCount hex digits into the top of a 24bits value. Returns false if
+// any of them isn't a hex digit.
+[[nodiscard]]
+bool ReadHexDigits(char const *hexData, size_t digitCount,
+                   std::uint32_t &value) noexcept {
+  std::uint8_t accumulatedValue = 0U;
+
+  value = 0U;
+
+  // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+  for (size_t index = 0U; index < s_hexCharCountPerUnit; ++index) {
+    std::uint8_t digitValue = 0U;
+
+    if (index < digitCount) {
+      digitValue = s_hexDecodeMap[static_cast<unsigned char>(hexData[index])];
+    }
+
+    accumulatedValue |= digitValue;
+
+    value = (value << s_bitCountHexChar) | (digitValue & s_lower4BitsMask);
+  }
+  // NOLINTEND(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+
+  return accumulatedValue <= s_lower4BitsMask;
+}
+} // namespace
+
+size_t HexCharCountFromBase64(std::string_view encodedData) noexcept {
+  return DecodedByteCountBase64(encodedData) * s_hexCharCountPerByte;
+}
+
+size_t Base64CharCountFromHex(std::string_view hexData) noexcept {
+  const size_t hexCharCount = std::size(hexData);
+
+  if (hexCharCount % s_hexCharCountPerByte != 0U) {
+    return 0U;
+  }
+
+  return EncodedCharCountBase64(hexCharCount / s_hexCharCountPerByte, 1U);
+}
+
+bool TranscodeBase64ToHex(std::string_view encodedData, std::span<char> hexData,
+                          bool isUpperCase) noexcept {
+  const size_t characterCount = std::size(encodedData);
+
+  if (characterCount % charCountBase64 != 0U ||
+      std::size(hexData) < HexCharCountFromBase64(encodedData)) {
+    return false;
+  }
+
+  const auto &hexDigits = isUpperCase ? s_upperHexDigits : s_hexDigits;
+
+  const size_t unitCount = characterCount / charCountBase64;
+  const size_t paddingCount =
+    unitCount * byteCountBase64 - DecodedByteCountBase64(encodedData);
+
+  // NOLINTBEGIN(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+  for (size_t unitIndex = 0U; unitIndex < unitCount; ++unitIndex) {
+    const bool isLastUnit = unitIndex + 1U == unitCount;
+    const size_t validCharCount =
+      isLastUnit ? charCountBase64 - paddingCount : charCountBase64;
+
+    char const *encodedUnit =
+      std::data(encodedData) + unitIndex * charCountBase64;
+
+    std::array<std::uint8_t, byteCountBase64> decodedUnit{};
+
+    const bool isDecoded =
+      isLastUnit
+        ? Detail::DecodeUnit(encodedUnit, validCharCount, decodedUnit)
+        : Detail::DecodeFullUnit(encodedUnit, std::data(decodedUnit));
+
+    if (!isDecoded) {
+      return false;
+    }
+
+    // 2 padding characters leave 1 byte and 1 leaves 2 bytes.
+    const size_t byteCount =
+      isLastUnit ? byteCountBase64 - paddingCount : byteCountBase64;
+
+    WriteHexDigits(std::data(decodedUnit), byteCount, hexDigits,
+                   std::data(hexData) + unitIndex * s_hexCharCountPerUnit);
+  }
+  // NOLINTEND(*-pro-bounds-pointer-arithmetic, *-constant-array-index)
+
+  return true;
+}
+
+std::optional<std::string> TranscodeBase64ToHex(std::string_view encodedData,
+                                                bool isUpperCase) {
+  std::string hexData(HexCharCountFromBase64(encodedData), '\0');
+
+  if (!TranscodeBase64ToHex(encodedData, hexData, isUpperCase)) {
+    return std::nullopt;
+  }
+
+  return hexData;
+}
+
+bool TranscodeHexToBase64(std::string_view hexData,
+                          std::span<char> encodedData) noexcept {
+  const size_t hexCharCount = std::size(hexData);
+
+  if (hexCharCount % s_hexCharCountPerByte != 0U ||
+      std::size(encodedData) < Base64CharCountFromHex(hexData)) {
+    return false;
+  }
+
+  size_t hIndex = 0U;
+  size_t cIndex = 0U;
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (; hIndex + s_hexCharCountPerUnit <= hexCharCount;
+       hIndex += s_hexCharCountPerUnit) {
+    std::uint32_t value = 0U;
+
+    if (!ReadHexDigits(std::data(hexData) + hIndex, s_hexCharCountPerUnit,
+                       value)) {
+      return false;
+    }
+
+    Detail::EncodeUnit(value, std::data(encodedData) + cIndex);
+
+    cIndex += charCountBase64;
+  }
+
+  const size_t remainingHexCount = hexCharCount - hIndex;
+
+  if (remainingHexCount != 0U) {
+    std::uint32_t value = 0U;
+
+    if (!ReadHexDigits(std::data(hexData) + hIndex, remainingHexCount,
+                       value)) {
+      return false;
+    }
+
+    Detail::EncodeUnit(value, std::data(encodedData) + cIndex);
+
+    // 2 digits are 1 byte, which only fills 2 characters, and 4 digits fill 3.
+    encodedData[cIndex + 3U] = paddingCharBase64;
+
+    if (remainingHexCount == s_hexCharCountPerByte) {
+      encodedData[cIndex + 2U] = paddingCharBase64;
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  return true;
+}
+
+std::optional<std::string> TranscodeHexToBase64(std::string_view hexData) {
+  std::string encodedData(Base64CharCountFromHex(hexData), '\0');
+
+  if (!TranscodeHexToBase64(hexData, encodedData)) {
+    return std::nullopt;
+  }
+
+  return encodedData;
+}
+} // namespace Phobos
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <Base64Calibration.hpp>
+#include <Base64EncodeService.hpp>
+#include <Base64Encoder.hpp>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace Phobos;
+
+TEST(Base64CalibrationTest, CalibrateTest) {
+  const size_t streamingThreshold = GetStreamingThresholdBase64();
+
+  const EncodeCalibration calibration = CalibrateEncode();
+
+  EXPECT_EQ(GetStreamingThresholdBase64(), streamingThreshold)
+    << "The calibration changed the streaming threshold.";
+
+  EXPECT_EQ(calibration.cpuModel, GetCpuModelName()) << "Wrong CPU model.";
+  EXPECT_EQ(calibration.encodeBytesPerSecond != 0U, true)
+    << "Throughput wasn't measured.";
+  EXPECT_EQ(calibration.inlineThreshold != 0U, true)
+    << "Inline threshold wasn't picked.";
+  EXPECT_EQ(std::has_single_bit(calibration.chunkByteCount), true)
+    << "Chunk size isn't a power of two.";
+
+  EncodeService service{EncodeServiceSettings{.workerCount = 1U}};
+
+  EXPECT_EQ(ApplyEncodeCalibration(calibration, service), streamingThreshold)
+    << "Wrong previous streaming threshold.";
+
+  EXPECT_EQ(service.GetInlineThreshold(), calibration.inlineThreshold)
+    << "Inline threshold wasn't applied.";
+  EXPECT_EQ(service.GetChunkByteCount(), calibration.chunkByteCount)
+    << "Chunk size wasn't applied.";
+  EXPECT_EQ(GetStreamingThresholdBase64(), calibration.streamingThreshold)
+    << "Streaming threshold wasn't applied.";
+
+  SetStreamingThresholdBase64(streamingThreshold);
+}
+
+TEST(Base64CalibrationTest, SaveAndLoadTest) {
+  const std::filesystem::path filePath =
+    std::filesystem::temp_directory_path() / "PhobosCalibrationTest.txt";
+
+  const EncodeCalibration calibration{
+    .cpuModel = GetCpuModelName(),
+    .hardwareConcurrency = std::max(std::thread::hardware_concurrency(), 1U),
+    // NOLINTBEGIN(*-magic-numbers)
+    .encodeBytesPerSecond = 1000U,
+    .handoffNanoseconds = 20U,
+    .inlineThreshold = 8192U,
+    .chunkByteCount = 65536U,
+    .streamingThreshold = 0U};
+  // NOLINTEND(*-magic-numbers)
+
+  EXPECT_EQ(SaveEncodeCalibration(filePath, calibration), true)
+    << "Couldn't save.";
+
+  {
+    const auto loadedCalibration = LoadEncodeCalibration(filePath);
+
+    ASSERT_EQ(loadedCalibration.has_value(), true) << "Couldn't load.";
+    EXPECT_EQ(loadedCalibration->inlineThreshold, 8192U)
+      << "Wrong inline threshold.";
+    EXPECT_EQ(loadedCalibration->chunkByteCount, 65536U)
+      << "Wrong chunk size.";
+    EXPECT_EQ(loadedCalibration->streamingThreshold, 0U)
+      << "Wrong streaming threshold.";
+    EXPECT_EQ(LoadOrCalibrateEncode(filePath).encodeBytesPerSecond, 1000U)
+      << "Saved calibration wasn't used.";
+  }
+
+  {
+    EncodeCalibration otherCalibration = calibration;
+
+    otherCalibration.cpuModel += " Other";
+
+    EXPECT_EQ(SaveEncodeCalibration(filePath, otherCalibration), true)
+      << "Couldn't save.";
+    EXPECT_EQ(LoadEncodeCalibration(filePath).has_value(), false)
+      << "Calibration of another CPU was loaded.";
+  }
+
+  {
+    std::ofstream{filePath} << "inlineThreshold=abc\n";
+
+    EXPECT_EQ(LoadEncodeCalibration(filePath).has_value(), false)
+      << "Malformed calibration was loaded.";
+  }
+
+  {
+    EXPECT_EQ(SaveEncodeCalibration(filePath, calibration), true)
+      << "Couldn't save.";
+
+    std::ofstream{filePath, std::ios::app} << "inlineThreshold=8192\n";
+
+    EXPECT_EQ(LoadEncodeCalibration(filePath).has_value(), false)
+      << "Calibration with a duplicated key was loaded.";
+  }
+
+  {
+    std::ofstream{filePath} << "cpuModel=" << calibration.cpuModel << '\n'
+                            << "hardwareConcurrency="
+                            << calibration.hardwareConcurrency << '\n'
+                            << "inlineThreshold=8192\n"
+                            << "inlineThreshold=8192\n"
+                            << "chunkByteCount=65536\n"
+                            << "encodeBytesPerSecond=1000\n"
+                            << "handoffNanoseconds=20\n";
+
+    EXPECT_EQ(LoadEncodeCalibration(filePath).has_value(), false)
+      << "Calibration with a missing key was loaded.";
+  }
+
+  std::filesystem::remove(filePath);
+
+  EXPECT_EQ(LoadEncodeCalibration(filePath).has_value(), false)
+    << "Missing calibration was loaded.";
+}
@@ -0,0 +1,268 @@
+#include <gtest/gtest.h>
+
+#include <Base64Decoder.hpp>
+#include <Base64Encoder.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace Phobos;
+
+TEST(Base64DecoderTest, IsValidBase64Test) {
+  EXPECT_EQ(IsValidBase64(""), true) << "Empty string is invalid.";
+  EXPECT_EQ(IsValidBase64("AgMD"), true) << "Valid string is invalid.";
+  EXPECT_EQ(IsValidBase64("AgM="), true) << "Valid string is invalid.";
+  EXPECT_EQ(IsValidBase64("Aw=="), true) << "Valid string is invalid.";
+  EXPECT_EQ(IsValidBase64("AP//+Q=="), true) << "Valid string is invalid.";
+
+  EXPECT_EQ(IsValidBase64("AgM"), false) << "Unpadded string is valid.";
+  EXPECT_EQ(IsValidBase64("A==="), false) << "Over padded string is valid.";
+  EXPECT_EQ(IsValidBase64("A=MD"), false) << "Inner padding is valid.";
+  EXPECT_EQ(IsValidBase64("Aw==AgMD"), false) << "Inner padding is valid.";
+  EXPECT_EQ(IsValidBase64("Ag-_"), false) << "Url alphabet is valid.";
+  EXPECT_EQ(IsValidBase64("Ag M"), false) << "Whitespace is valid.";
+
+  {
+    // Goes through the block scan.
+    std::string encodedData(128U, 'A');
+
+    EXPECT_EQ(IsValidBase64(encodedData), true) << "Valid string is invalid.";
+
+    encodedData[70U] = '\x80';
+
+    EXPECT_EQ(IsValidBase64(encodedData), false) << "Invalid string is valid.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint8_t, 9U> data{9U, 7U, 5U, 3U, 1U, 6U, 2U, 4U, 8U};
+
+    for (size_t count = 0U; count <= std::size(data); ++count) {
+      EXPECT_EQ(IsValidBase64(EncodeBase64Str(std::data(data), count, 1U)),
+                true)
+        << "Encoded string is invalid.";
+    }
+  }
+}
+
+TEST(Base64DecoderTest, IsValidBase64UrlTest) {
+  EXPECT_EQ(IsValidBase64Url("Ag-_"), true) << "Valid string is invalid.";
+  EXPECT_EQ(IsValidBase64Url("AgM"), true) << "Unpadded string is invalid.";
+  EXPECT_EQ(IsValidBase64Url("Aw"), true) << "Unpadded string is invalid.";
+  EXPECT_EQ(IsValidBase64Url("Aw=="), true) << "Padded string is invalid.";
+
+  EXPECT_EQ(IsValidBase64Url("A"), false) << "Single character is valid.";
+  EXPECT_EQ(IsValidBase64Url("Ag+/"), false) << "Standard alphabet is valid.";
+  EXPECT_EQ(IsValidBase64Url("Aw="), false) << "Partial padding is valid.";
+}
+
+TEST(Base64DecoderTest, DecodeBase64RangeTest) {
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint8_t, 10U> data{9U, 7U, 5U, 3U, 1U, 6U, 2U, 4U, 8U, 0U};
+
+    const std::string encodedData =
+      EncodeBase64Str(std::data(data), std::size(data), 1U);
+
+    EXPECT_EQ(DecodedByteCountBase64(encodedData), std::size(data))
+      << "Wrong decoded byte count.";
+
+    for (size_t offset = 0U; offset <= std::size(data); ++offset) {
+      for (size_t count = 0U; offset + count <= std::size(data); ++count) {
+        const auto decodedData =
+          DecodeBase64Range(encodedData, offset, count, 1U);
+
+        ASSERT_EQ(decodedData.has_value(), true) << "Couldn't decode range.";
+        EXPECT_EQ(std::equal(std::begin(*decodedData), std::end(*decodedData),
+                             std::begin(data) + offset),
+                  true)
+          << "Wrong decoded range.";
+      }
+    }
+
+    EXPECT_EQ(DecodeBase64Range(encodedData, 9U, 2U, 1U).has_value(), false)
+      << "Out of bounds range decoded.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint16_t, 5U> data{0xfff9U, 2U, 3U, 0x1234U, 7U};
+
+    const std::string encodedData =
+      EncodeBase64Str(std::data(data), std::size(data), sizeof(std::uint16_t));
+
+    const auto decodedData = DecodeBase64Range(encodedData, 1U, 3U, 2U);
+
+    ASSERT_EQ(decodedData.has_value(), true) << "Couldn't decode range.";
+    EXPECT_EQ(memcmp(std::data(*decodedData), std::data(data) + 1U, 6U), 0)
+      << "Wrong decoded range.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint64_t, 3U> data{0xfffffffff9LLU, 2U, 0x123456789aLLU};
+
+    const std::string encodedData =
+      EncodeBase64Str(std::data(data), std::size(data), sizeof(std::uint64_t));
+
+    const auto decodedData = DecodeBase64(encodedData, sizeof(std::uint64_t));
+
+    ASSERT_EQ(decodedData.has_value(), true) << "Couldn't decode.";
+    EXPECT_EQ(memcmp(std::data(*decodedData), std::data(data), sizeof(data)), 0)
+      << "Wrong decoded data.";
+  }
+
+  EXPECT_EQ(DecodeBase64("Ag-D").has_value(), false)
+    << "Invalid string decoded.";
+
+  for (const char *malformedData : {"AgM", "ABCDE", "A", "TQ="}) {
+    EXPECT_EQ(DecodeBase64(malformedData).has_value(), false)
+      << "Malformed length decoded.";
+  }
+
+  EXPECT_EQ(DecodeBase64("AgMD", 2U).has_value(), false)
+    << "Partial element decoded.";
+  {
+    const auto decodedData = DecodeBase64("AgMDBA==", 2U);
+
+    ASSERT_EQ(decodedData.has_value(), true) << "Couldn't decode.";
+    EXPECT_EQ(std::size(*decodedData), 4U) << "Wrong decoded byte count.";
+  }
+  EXPECT_EQ(DecodeBase64("").has_value(), true) << "Couldn't decode empty.";
+}
+
+namespace {
+template <typename T>
+[[nodiscard]]
+bool IsTypedRoundTripExact(size_t elementCount, std::endian byteOrder) {
+  std::vector<T> data(elementCount);
+
+  for (size_t index = 0U; index < elementCount; ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<T>(0x0123456789abcdefLLU * (index + 1U));
+  }
+
+  const std::string encodedData =
+    EncodeBase64Str(std::data(data), elementCount, sizeof(T), byteOrder);
+
+  std::vector<T> decodedData(elementCount);
+
+  const bool isDecoded =
+    byteOrder == std::endian::big
+      ? DecodeBase64(encodedData, std::span<T>{decodedData})
+      : DecodeBase64<std::endian::little>(encodedData,
+                                          std::span<T>{decodedData});
+
+  return isDecoded && decodedData == data;
+}
+} // namespace
+
+TEST(Base64DecoderTest, DecodeBase64TypedTest) {
+  // Every remainder of the units across the elements.
+  // NOLINTNEXTLINE(*-magic-numbers)
+  for (size_t count = 0U; count < 20U; ++count) {
+    for (const std::endian byteOrder :
+         {std::endian::big, std::endian::little}) {
+      EXPECT_EQ(IsTypedRoundTripExact<std::uint8_t>(count, byteOrder), true)
+        << "Wrong decoded 8bits.";
+      EXPECT_EQ(IsTypedRoundTripExact<std::uint16_t>(count, byteOrder), true)
+        << "Wrong decoded 16bits.";
+      EXPECT_EQ(IsTypedRoundTripExact<std::uint32_t>(count, byteOrder), true)
+        << "Wrong decoded 32bits.";
+      EXPECT_EQ(IsTypedRoundTripExact<std::uint64_t>(count, byteOrder), true)
+        << "Wrong decoded 64bits.";
+    }
+  }
+
+  {
+    std::array<std::uint16_t, 2U> decodedData{};
+
+    // 3 elements worth of characters.
+    EXPECT_EQ(DecodeBase64("//kAAgAD", std::span{decodedData}), false)
+      << "Wrong element count decoded.";
+    // 5 bytes, which isn't whole elements.
+    EXPECT_EQ(DecodeBase64("//kAAgA=", std::span{decodedData}), false)
+      << "Partial element decoded.";
+    EXPECT_EQ(DecodeBase64("//k-AgA=", std::span{decodedData}), false)
+      << "Invalid string decoded.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint16_t, 3U> decodedData{};
+
+    EXPECT_EQ(DecodeBase64("//kAAgAD", std::span{decodedData}), true)
+      << "Couldn't decode.";
+    // NOLINTNEXTLINE(*-magic-numbers)
+    EXPECT_EQ(decodedData, (std::array<std::uint16_t, 3U>{0xfff9U, 2U, 3U}))
+      << "Wrong decoded elements.";
+  }
+}
+
+TEST(Base64DecoderTest, DecodeBase64LenientTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> data(200U);
+
+  for (size_t index = 0U; index < std::size(data); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint8_t>(index * 29U + 5U);
+  }
+
+  // NOLINTNEXTLINE(*-magic-numbers)
+  for (const size_t byteCount : {0U, 1U, 2U, 3U, 57U, 58U, 200U}) {
+    const std::string encodedData =
+      EncodeBase64Str(std::data(data), byteCount, 1U);
+    const std::vector<std::uint8_t> expectedData(
+      std::begin(data),
+      std::begin(data) + static_cast<std::ptrdiff_t>(byteCount));
+
+    // 76 and 64 columns like MIME and PEM, and 7 to split the units.
+    // NOLINTNEXTLINE(*-magic-numbers)
+    for (const size_t lineLength : {76U, 64U, 7U}) {
+      std::string wrappedData{"  "};
+
+      for (size_t index = 0U; index < std::size(encodedData);
+           index += lineLength) {
+        wrappedData += encodedData.substr(index, lineLength);
+        wrappedData += "\r\n\t";
+      }
+
+      EXPECT_EQ(DecodeBase64Lenient(wrappedData), expectedData)
+        << "Wrong decoded wrapped string.";
+    }
+
+    EXPECT_EQ(DecodeBase64Lenient(encodedData), expectedData)
+      << "Wrong decoded plain string.";
+  }
+
+  EXPECT_EQ(DecodeBase64Lenient("TW Fu\n"),
+            (std::vector<std::uint8_t>{'M', 'a', 'n'}))
+    << "Wrong decoded split unit.";
+  EXPECT_EQ(DecodeBase64Lenient("TW\n==\n"),
+            (std::vector<std::uint8_t>{'M'}))
+    << "Wrong decoded split padding.";
+
+  EXPECT_EQ(DecodeBase64Lenient("TWF").has_value(), false)
+    << "Unpadded string decoded.";
+  EXPECT_EQ(DecodeBase64Lenient("TW=\n=TWFu").has_value(), false)
+    << "Data after the padding decoded.";
+  EXPECT_EQ(DecodeBase64Lenient("TWFu=").has_value(), false)
+    << "Extra padding decoded.";
+  EXPECT_EQ(DecodeBase64Lenient("TW-u").has_value(), false)
+    << "Invalid character decoded.";
+
+  {
+    std::array<std::uint8_t, 2U> decodedData{};
+
+    EXPECT_EQ(DecodeBase64Lenient("TW\nFu", decodedData).has_value(), false)
+      << "Decoded into a small span.";
+    EXPECT_EQ(DecodeBase64Lenient(" TW E=", decodedData),
+              std::optional<size_t>{2U})
+      << "Wrong decoded byte count.";
+  }
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <Base64EncodeCache.hpp>
+#include <Base64Encoder.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Phobos;
+
+TEST(Base64EncodeCacheTest, HitAndMissTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  EncodeCache cache{1024U};
+
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::uint32_t, 4U> data{2U, 3U, 7U, 0x12345678U};
+
+  const auto encodedData = cache.EncodeBase64Str(std::data(data), 4U, 4U);
+
+  EXPECT_EQ(*encodedData, "AAAAAgAAAAMAAAAHEjRWeA==")
+    << "Wrong encoded string.";
+
+  const auto cachedData = cache.EncodeBase64Str(std::data(data), 4U, 4U);
+
+  EXPECT_EQ(cachedData.get(), encodedData.get())
+    << "The hit made a new string.";
+
+  // Same bytes with a different primitive size or byte order are different
+  // entries.
+  EXPECT_EQ(*cache.EncodeBase64Str(std::data(data), 16U, 1U),
+            EncodeBase64Str(std::data(data), 16U, 1U))
+    << "Wrong encoded string.";
+  EXPECT_EQ(
+    *cache.EncodeBase64Str(std::data(data), 4U, 4U, std::endian::little),
+    EncodeBase64Str(std::data(data), 4U, 4U, std::endian::little))
+    << "Wrong encoded string.";
+
+  // A changed payload isn't served from the old entry.
+  data[1] = 9U;
+
+  EXPECT_EQ(*cache.EncodeBase64Str(std::data(data), 4U, 4U),
+            EncodeBase64Str(std::data(data), 4U, 4U))
+    << "Stale string was returned.";
+
+  EXPECT_EQ(std::empty(*cache.EncodeBase64Str(std::data(data), 4U, 0U)), true)
+    << "Zero primitive size isn't empty.";
+
+  const EncodeCacheStats stats = cache.GetStats();
+
+  EXPECT_EQ(stats.hitCount, 1U) << "Wrong hit count.";
+  EXPECT_EQ(stats.missCount, 4U) << "Wrong miss count.";
+  EXPECT_EQ(stats.entryCount, 4U) << "Wrong entry count.";
+}
+
+TEST(Base64EncodeCacheTest, EvictionTest) {
+  // 3 source bytes and 4 characters per entry, so only 2 entries fit.
+  // NOLINTNEXTLINE(*-magic-numbers)
+  EncodeCache cache{14U};
+
+  std::array<std::uint8_t, 3U> data1{1U, 2U, 3U};
+  std::array<std::uint8_t, 3U> data2{4U, 5U, 6U};
+  std::array<std::uint8_t, 3U> data3{7U, 8U, 9U};
+
+  auto encodedData = cache.EncodeBase64Str(std::data(data1), 3U, 1U);
+
+  encodedData = cache.EncodeBase64Str(std::data(data2), 3U, 1U);
+  // Makes data2 the least recently used one.
+  encodedData = cache.EncodeBase64Str(std::data(data1), 3U, 1U);
+  encodedData = cache.EncodeBase64Str(std::data(data3), 3U, 1U);
+
+  {
+    const EncodeCacheStats stats = cache.GetStats();
+
+    EXPECT_EQ(stats.evictionCount, 1U) << "Wrong eviction count.";
+    EXPECT_EQ(stats.entryCount, 2U) << "Wrong entry count.";
+    EXPECT_EQ(stats.byteCount, 14U) << "Wrong byte count.";
+  }
+
+  encodedData = cache.EncodeBase64Str(std::data(data1), 3U, 1U);
+
+  EXPECT_EQ(cache.GetStats().hitCount, 2U)
+    << "Recently used entry was evicted.";
+
+  // Doesn't fit in the budget.
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> largeData(30U, 1U);
+
+  encodedData = cache.EncodeBase64Str(std::data(largeData), 30U, 1U);
+
+  EXPECT_EQ(*encodedData, EncodeBase64Str(std::data(largeData), 30U, 1U))
+    << "Wrong encoded string.";
+  EXPECT_EQ(cache.GetStats().entryCount, 2U) << "Large payload was cached.";
+
+  cache.SetByteBudget(7U);
+
+  EXPECT_EQ(cache.GetStats().entryCount, 1U) << "Lower budget didn't evict.";
+
+  cache.Clear();
+
+  EXPECT_EQ(cache.GetStats().byteCount, 0U) << "Cache wasn't cleared.";
+}
+
+TEST(Base64EncodeCacheTest, ConcurrentTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  EncodeCache cache{4096U};
+
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::uint16_t, 3U> data1{0xfff9U, 2U, 3U};
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::uint16_t, 3U> data2{0x1234U, 7U, 0U};
+
+  const std::string expectedData1 = EncodeBase64Str(std::data(data1), 3U, 2U);
+  const std::string expectedData2 = EncodeBase64Str(std::data(data2), 3U, 2U);
+
+  std::vector<std::thread> threads{};
+  std::array<bool, 4U> results{};
+
+  for (size_t index = 0U; index < std::size(results); ++index) {
+    threads.emplace_back([&, index] {
+      bool isCorrect = true;
+
+      // NOLINTNEXTLINE(*-magic-numbers)
+      for (size_t count = 0U; count < 200U; ++count) {
+        isCorrect = isCorrect &&
+                    *cache.EncodeBase64Str(std::data(data1), 3U, 2U) ==
+                      expectedData1 &&
+                    *cache.EncodeBase64Str(std::data(data2), 3U, 2U) ==
+                      expectedData2;
+      }
+
+      results[index] = isCorrect;
+    });
+  }
+
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  for (const bool isCorrect : results) {
+    EXPECT_EQ(isCorrect, true) << "Wrong encoded string.";
+  }
+
+  const EncodeCacheStats stats = cache.GetStats();
+
+  EXPECT_EQ(stats.hitCount + stats.missCount, 1600U) << "Lost a lookup.";
+  EXPECT_EQ(stats.entryCount, 2U) << "Wrong entry count.";
+}
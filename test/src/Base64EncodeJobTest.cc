@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <Base64EncodeJob.hpp>
+#include <Base64Encoder.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace Phobos;
+
+TEST(Base64EncodeJobTest, ByteBudgetTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> data(16U * 100U);
+
+  for (size_t index = 0U; index < std::size(data); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint8_t>(index * 73U + 19U);
+  }
+
+  // NOLINTNEXTLINE(*-magic-numbers)
+  for (const size_t primitiveSize : {1U, 2U, 4U, 5U, 8U, 16U}) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    for (const size_t elementCount : {0U, 1U, 7U, 100U}) {
+      const std::string expectedData =
+        EncodeBase64Str(std::data(data), elementCount, primitiveSize);
+
+      std::string encodedData(std::size(expectedData), '\0');
+
+      EncodeJob job{std::data(data), elementCount, primitiveSize, encodedData};
+
+      EXPECT_EQ(job.IsValid(), true) << "The job is invalid.";
+
+      size_t lastByteCount = 0U;
+
+      // A budget smaller than a block still encodes a block.
+      while (!job.IsComplete()) {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const EncodeJobProgress progress = job.Step(size_t{10U});
+
+        EXPECT_EQ(progress.byteCount > lastByteCount, true)
+          << "The step didn't make progress.";
+        EXPECT_EQ(progress.charCount,
+                  EncodedCharCountBase64(progress.byteCount, 1U))
+          << "Wrong character count.";
+
+        lastByteCount = progress.byteCount;
+      }
+
+      EXPECT_EQ(job.GetProgress().isComplete, true) << "Not complete.";
+      EXPECT_EQ(encodedData, expectedData) << "Wrong encoded string.";
+    }
+  }
+}
+
+TEST(Base64EncodeJobTest, TimeBudgetTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> data(100000U);
+
+  for (size_t index = 0U; index < std::size(data); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint8_t>(index * 7U + 1U);
+  }
+
+  const std::string expectedData =
+    EncodeBase64Str(std::data(data), std::size(data) / 4U, 4U);
+
+  {
+    std::string encodedData(std::size(expectedData), '\0');
+
+    EncodeJob job{std::data(data), std::size(data) / 4U, 4U, encodedData};
+
+    // A zero budget encodes a single slice.
+    const EncodeJobProgress progress = job.Step(std::chrono::nanoseconds{0});
+
+    EXPECT_EQ(progress.isComplete, false) << "Encoded past the budget.";
+    EXPECT_EQ(progress.byteCount % 12U, 0U) << "The slice isn't aligned.";
+
+    while (!job.Step(std::chrono::nanoseconds{0}).isComplete) {
+    }
+
+    EXPECT_EQ(encodedData, expectedData) << "Wrong encoded string.";
+  }
+
+  {
+    std::string encodedData(std::size(expectedData), '\0');
+
+    EncodeJob job{std::data(data), std::size(data) / 4U, 4U, encodedData};
+
+    EXPECT_EQ(job.Step(std::chrono::seconds{10}).isComplete, true)
+      << "Couldn't finish within the budget.";
+    EXPECT_EQ(encodedData, expectedData) << "Wrong encoded string.";
+  }
+}
+
+TEST(Base64EncodeJobTest, InvalidJobTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> data(12U);
+  std::string encodedData(15U, '\0');
+
+  EncodeJob smallJob{std::data(data), std::size(data), 1U, encodedData};
+  EncodeJob zeroSizeJob{std::data(data), 1U, 0U, encodedData};
+
+  EXPECT_EQ(smallJob.IsValid(), false) << "A small output was valid.";
+  EXPECT_EQ(zeroSizeJob.IsValid(), false) << "A zero primitive size was valid.";
+  EXPECT_EQ(smallJob.Step(size_t{1U}).isComplete, true)
+    << "An invalid job isn't complete.";
+  EXPECT_EQ(zeroSizeJob.Step(std::chrono::nanoseconds{1}).byteCount, 0U)
+    << "An invalid job encoded.";
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <Base64EncodeService.hpp>
+#include <Base64Encoder.hpp>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Phobos;
+
+namespace {
+[[nodiscard]]
+std::vector<std::uint32_t> MakeData(size_t elementCount) {
+  std::vector<std::uint32_t> data(elementCount, 0U);
+
+  for (size_t index = 0U; index < elementCount; ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint32_t>(index * 2654435761U);
+  }
+
+  return data;
+}
+} // namespace
+
+TEST(Base64EncodeServiceTest, SubmitTest) {
+  // Small chunks, so the jobs are split between the workers.
+  EncodeService service{EncodeServiceSettings{
+    .workerCount = 4U, .inlineThreshold = 64U, .chunkByteCount = 100U}};
+
+  // NOLINTNEXTLINE(*-magic-numbers)
+  const std::vector<std::uint32_t> data = MakeData(1000U);
+
+  for (const size_t elementCount : {0U, 3U, 16U, 25U, 999U, 1000U}) {
+    std::future<std::string> encodedData =
+      service.Submit(std::data(data), elementCount, sizeof(std::uint32_t));
+
+    EXPECT_EQ(encodedData.get(), EncodeBase64Str(std::data(data), elementCount,
+                                                 sizeof(std::uint32_t)))
+      << "Wrong encoded string.";
+  }
+
+  {
+    std::promise<std::string> promise{};
+
+    service.Submit(
+      std::data(data), std::size(data), sizeof(std::uint32_t),
+      [&promise](std::string encodedData) {
+        promise.set_value(std::move(encodedData));
+      },
+      std::endian::native);
+
+    EXPECT_EQ(promise.get_future().get(),
+              EncodeBase64Str(std::data(data), std::size(data) * 4U, 1U))
+      << "Wrong encoded string.";
+  }
+
+  const EncodeServiceStats stats = service.GetStats();
+
+  EXPECT_EQ(stats.submittedJobCount, 7U) << "Wrong submitted job count.";
+  EXPECT_EQ(stats.completedJobCount, 7U) << "Wrong completed job count.";
+  EXPECT_EQ(stats.inlineJobCount, 2U) << "Wrong inline job count.";
+  EXPECT_EQ(stats.queueDepth, 0U) << "Chunks are still queued.";
+}
+
+TEST(Base64EncodeServiceTest, ConcurrentSubmitTest) {
+  EncodeService service{EncodeServiceSettings{
+    .workerCount = 3U, .inlineThreshold = 256U, .chunkByteCount = 512U}};
+
+  // NOLINTNEXTLINE(*-magic-numbers)
+  const std::vector<std::uint32_t> data = MakeData(4096U);
+
+  constexpr size_t threadCount = 8U;
+  constexpr size_t jobCountPerThread = 16U;
+
+  std::vector<std::thread> threads{};
+  std::vector<size_t> mismatchCounts(threadCount, 0U);
+
+  for (size_t threadIndex = 0U; threadIndex < threadCount; ++threadIndex) {
+    threads.emplace_back([&, threadIndex] {
+      for (size_t jobIndex = 0U; jobIndex < jobCountPerThread; ++jobIndex) {
+        const size_t elementCount =
+          // NOLINTNEXTLINE(*-magic-numbers)
+          (threadIndex * 977U + jobIndex * 131U) % std::size(data);
+
+        std::string encodedData =
+          service.Submit(std::data(data), elementCount, sizeof(std::uint32_t))
+            .get();
+
+        if (encodedData != EncodeBase64Str(std::data(data), elementCount,
+                                           sizeof(std::uint32_t))) {
+          ++mismatchCounts[threadIndex];
+        }
+      }
+    });
+  }
+
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  for (const size_t mismatchCount : mismatchCounts) {
+    EXPECT_EQ(mismatchCount, 0U) << "Wrong encoded string.";
+  }
+
+  EXPECT_EQ(service.GetStats().completedJobCount,
+            threadCount * jobCountPerThread)
+    << "Wrong completed job count.";
+}
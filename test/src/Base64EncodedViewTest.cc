@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <Base64EncodedView.hpp>
+#include <Base64Encoder.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+
+using namespace Phobos;
+
+TEST(Base64EncodedViewTest, WriteAndFlushTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::uint8_t, 10U> data{9U, 7U, 5U, 3U, 1U, 6U, 2U, 4U, 8U, 0U};
+
+  Base64EncodedView view{std::data(data), std::size(data), 1U};
+
+  EXPECT_EQ(view.GetText(),
+            EncodeBase64Str(std::data(data), std::size(data), 1U))
+    << "Wrong initial text.";
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    const std::array<std::uint8_t, 2U> patch{0xffU, 0xf9U};
+
+    EXPECT_EQ(view.Write(2U, std::data(patch), std::size(patch)), true)
+      << "Couldn't write.";
+    EXPECT_EQ(view.IsDirty(), true) << "The view isn't dirty.";
+
+    view.Flush();
+
+    EXPECT_EQ(view.IsDirty(), false) << "The view is dirty.";
+    EXPECT_EQ(view.GetText(),
+              EncodeBase64Str(std::data(data), std::size(data), 1U))
+      << "Wrong text after flush.";
+  }
+
+  {
+    data[9U] = 0xffU;
+    data[0U] = 0x11U;
+
+    view.MarkDirty(9U, 1U);
+    view.MarkDirty(0U, 1U);
+    view.Flush();
+
+    EXPECT_EQ(view.GetText(),
+              EncodeBase64Str(std::data(data), std::size(data), 1U))
+      << "Wrong text after flush.";
+  }
+
+  EXPECT_EQ(view.Write(9U, std::data(data), 2U), false)
+    << "Out of bounds write succeeded.";
+}
+
+TEST(Base64EncodedViewTest, MergeDirtyTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::uint8_t, 30U> data{};
+
+  Base64EncodedView view{std::data(data), std::size(data), 1U};
+
+  // Marking the same bytes again doesn't add ranges.
+  // NOLINTNEXTLINE(*-magic-numbers)
+  for (size_t index = 0U; index < 100U; ++index) {
+    view.MarkDirty(0U, 1U);
+  }
+
+  EXPECT_EQ(view.GetDirtyRangeCount(), 1U) << "Same range wasn't merged.";
+
+  // Blocks 3 and 6, then 4 and 5 which join them into one range.
+  // NOLINTBEGIN(*-magic-numbers)
+  view.MarkDirty(9U, 1U);
+  view.MarkDirty(18U, 1U);
+
+  EXPECT_EQ(view.GetDirtyRangeCount(), 3U) << "Disjoint ranges were merged.";
+
+  view.MarkDirty(12U, 6U);
+  // NOLINTEND(*-magic-numbers)
+
+  EXPECT_EQ(view.GetDirtyRangeCount(), 2U) << "Touching ranges weren't merged.";
+
+  data.fill(0xabU);
+
+  view.MarkDirty(0U, std::size(data));
+
+  EXPECT_EQ(view.GetDirtyRangeCount(), 1U) << "Covered ranges weren't merged.";
+
+  view.Flush();
+
+  EXPECT_EQ(view.GetText(),
+            EncodeBase64Str(std::data(data), std::size(data), 1U))
+    << "Wrong text after flush.";
+}
+
+TEST(Base64EncodedViewTest, WideElementTest) {
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint16_t, 7U> data{9U, 7U, 5U, 3U, 1U, 6U, 2U};
+
+    Base64EncodedView view{std::data(data), std::size(data), 2U};
+
+    EXPECT_EQ(view.GetBlockByteCount(), 6U) << "Wrong block size.";
+
+    // NOLINTNEXTLINE(*-magic-numbers)
+    const std::uint16_t value = 0x1234U;
+
+    EXPECT_EQ(view.Write(3U * sizeof(value), &value, sizeof(value)), true)
+      << "Couldn't write.";
+
+    data[6U] = 0xfff9U;
+
+    view.MarkDirty(6U * sizeof(value), sizeof(value));
+    view.Flush();
+
+    EXPECT_EQ(view.GetText(),
+              EncodeBase64Str(std::data(data), std::size(data), 2U))
+      << "Wrong text after flush.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint64_t, 5U> data{2U, 3U, 7U, 99U, 5U};
+
+    Base64EncodedView view{std::data(data), std::size(data), 8U};
+
+    EXPECT_EQ(view.GetBlockByteCount(), 24U) << "Wrong block size.";
+
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[1U] = 0xfffffffff9LLU;
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[4U] = 0x123456789aLLU;
+
+    view.MarkDirty(1U * sizeof(std::uint64_t), sizeof(std::uint64_t));
+    view.MarkDirty(4U * sizeof(std::uint64_t), sizeof(std::uint64_t));
+    view.Flush();
+
+    EXPECT_EQ(view.GetText(),
+              EncodeBase64Str(std::data(data), std::size(data), 8U))
+      << "Wrong text after flush.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint32_t, 5U> data{2U, 3U, 7U, 0x12345678U, 5U};
+
+    Base64EncodedView view{std::data(data), std::size(data), 4U,
+                           std::endian::little};
+
+    EXPECT_EQ(view.GetText(), EncodeBase64Str(std::data(data), std::size(data),
+                                              4U, std::endian::little))
+      << "Wrong little endian text.";
+
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[3U] = 0xfffffff9U;
+
+    view.MarkDirty(3U * sizeof(std::uint32_t), sizeof(std::uint32_t));
+    view.Flush();
+
+    EXPECT_EQ(view.GetText(), EncodeBase64Str(std::data(data), std::size(data),
+                                              4U, std::endian::little))
+      << "Wrong little endian text after flush.";
+  }
+}
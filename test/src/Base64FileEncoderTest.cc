@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <Base64Encoder.hpp>
+#include <Base64FileEncoder.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace Phobos;
+
+namespace {
+[[nodiscard]]
+std::string ReadFile(const std::filesystem::path &filePath) {
+  std::ifstream file{filePath, std::ios::binary};
+
+  return std::string{std::istreambuf_iterator<char>{file},
+                     std::istreambuf_iterator<char>{}};
+}
+
+void WriteFile(const std::filesystem::path &filePath,
+               const std::vector<std::uint8_t> &data) {
+  std::ofstream file{filePath, std::ios::binary | std::ios::trunc};
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  file.write(reinterpret_cast<char const *>(std::data(data)),
+             static_cast<std::streamsize>(std::size(data)));
+}
+} // namespace
+
+TEST(Base64FileEncoderTest, EncodeFileTest) {
+  const std::filesystem::path inputPath =
+    std::filesystem::temp_directory_path() / "PhobosFileEncoderInput.bin";
+  const std::filesystem::path outputPath =
+    std::filesystem::temp_directory_path() / "PhobosFileEncoderOutput.txt";
+
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> data(100004U);
+
+  for (size_t index = 0U; index < std::size(data); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint8_t>(index * 131U + index / 7U);
+  }
+
+  WriteFile(inputPath, data);
+
+  {
+    // Many more chunks than buffers, so the buffers are reused.
+    // NOLINTNEXTLINE(*-magic-numbers)
+    const FileEncodeSettings settings{.bufferByteCount = 1000U,
+                                      .bufferCount = 3U};
+
+    const auto stats = EncodeFileBase64(inputPath, outputPath, settings);
+
+    ASSERT_EQ(stats.has_value(), true) << "Couldn't encode the file.";
+    EXPECT_EQ(stats->byteCount, std::size(data)) << "Wrong byte count.";
+    // 1000 bytes are rounded down to 999.
+    // NOLINTNEXTLINE(*-magic-numbers)
+    EXPECT_EQ(stats->chunkCount, 101U) << "Wrong chunk count.";
+    EXPECT_EQ(ReadFile(outputPath),
+              EncodeBase64Str(std::data(data), std::size(data), 1U))
+      << "Wrong encoded file.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    const FileEncodeSettings settings{.bufferByteCount = 1000U,
+                                      .bufferCount = 2U,
+                                      .primitiveSize = 4U,
+                                      .byteOrder = std::endian::little};
+
+    const auto stats = EncodeFileBase64(inputPath, outputPath, settings);
+
+    ASSERT_EQ(stats.has_value(), true) << "Couldn't encode the file.";
+    EXPECT_EQ(ReadFile(outputPath),
+              EncodeBase64Str(std::data(data), std::size(data) / 4U, 4U,
+                              std::endian::little))
+      << "Wrong encoded file.";
+  }
+
+  {
+    // The file size isn't a multiple of 8.
+    const FileEncodeSettings settings{.primitiveSize = 8U};
+
+    EXPECT_EQ(EncodeFileBase64(inputPath, outputPath, settings).has_value(),
+              false)
+      << "Partial elements were encoded.";
+  }
+
+  EXPECT_EQ(EncodeFileBase64(inputPath, outputPath,
+                             FileEncodeSettings{.bufferCount = 1U})
+              .has_value(),
+            false)
+    << "Single buffer was accepted.";
+
+  WriteFile(inputPath, {});
+
+  EXPECT_EQ(EncodeFileBase64(inputPath, outputPath).has_value(), true)
+    << "Couldn't encode an empty file.";
+  EXPECT_EQ(ReadFile(outputPath), "") << "Wrong encoded empty file.";
+
+  std::filesystem::remove(inputPath);
+  std::filesystem::remove(outputPath);
+
+  EXPECT_EQ(EncodeFileBase64(inputPath, outputPath).has_value(), false)
+    << "Missing file was encoded.";
+}
+
+TEST(Base64FileEncoderTest, EncodeFileBigEndianTest) {
+  const std::filesystem::path inputPath =
+    std::filesystem::temp_directory_path() / "PhobosFileEncoderBigInput.bin";
+  const std::filesystem::path outputPath =
+    std::filesystem::temp_directory_path() / "PhobosFileEncoderBigOutput.txt";
+
+  // A multiple of 48, so every primitive size has whole elements.
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> data(100032U);
+
+  for (size_t index = 0U; index < std::size(data); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint8_t>(index * 131U + index / 7U);
+  }
+
+  WriteFile(inputPath, data);
+
+  // Widths which aren't powers of two or wider than 8 bytes included.
+  // NOLINTNEXTLINE(*-magic-numbers)
+  for (const size_t primitiveSize : {2U, 3U, 4U, 8U, 16U, 24U}) {
+    // The default byte order is big endian, so the elements are swapped.
+    // NOLINTNEXTLINE(*-magic-numbers)
+    const FileEncodeSettings settings{.bufferByteCount = 1000U,
+                                      .bufferCount = 2U,
+                                      .primitiveSize = primitiveSize};
+
+    const auto stats = EncodeFileBase64(inputPath, outputPath, settings);
+
+    ASSERT_EQ(stats.has_value(), true) << "Couldn't encode the file.";
+    EXPECT_EQ(ReadFile(outputPath),
+              EncodeBase64Str(std::data(data), std::size(data) / primitiveSize,
+                              primitiveSize))
+      << "Wrong encoded file.";
+  }
+
+  std::filesystem::remove(inputPath);
+  std::filesystem::remove(outputPath);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <Base64Encoder.hpp>
+#include <Base64RecordEncoder.hpp>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace Phobos;
+
+namespace {
+struct WireRecord {
+  std::uint16_t id;
+  std::array<std::uint8_t, 3U> tag;
+  std::uint32_t length;
+  std::uint64_t timestamp;
+};
+
+template <typename T>
+void AppendElement(std::vector<std::uint8_t> &serialisedData, T value,
+                   std::endian byteOrder) {
+  if (byteOrder != std::endian::native) {
+    value = std::byteswap(value);
+  }
+
+  std::array<std::uint8_t, sizeof(T)> bytes{};
+
+  memcpy(std::data(bytes), &value, sizeof(T));
+
+  serialisedData.insert(std::end(serialisedData), std::begin(bytes),
+                        std::end(bytes));
+}
+} // namespace
+
+TEST(Base64RecordEncoderTest, EncodeRecordsTest) {
+  constexpr std::array fields{
+    RecordFieldBase64{.offset = offsetof(WireRecord, id), .primitiveSize = 2U},
+    RecordFieldBase64{
+      .offset = offsetof(WireRecord, tag), .primitiveSize = 1U,
+      .elementCount = 3U},
+    RecordFieldBase64{.offset = offsetof(WireRecord, length),
+                      .primitiveSize = 4U,
+                      .byteOrder = std::endian::little},
+    RecordFieldBase64{
+      .offset = offsetof(WireRecord, timestamp), .primitiveSize = 8U}};
+
+  const RecordEncoder encoder{sizeof(WireRecord), fields};
+
+  EXPECT_EQ(encoder.IsValid(), true) << "The schema is invalid.";
+  EXPECT_EQ(encoder.GetEncodedByteCount(), 17U) << "Wrong record byte count.";
+
+  std::vector<WireRecord> records{};
+  std::vector<std::uint8_t> serialisedData{};
+
+  // 17 bytes per record, so every unit alignment across the records is hit.
+  // NOLINTBEGIN(*-magic-numbers)
+  for (std::uint32_t index = 0U; index < 7U; ++index) {
+    const WireRecord record{
+      .id = static_cast<std::uint16_t>(0xA0B1U + index),
+      .tag = {static_cast<std::uint8_t>(index), 0x7FU, 0xFEU},
+      .length = 0x01020304U * (index + 1U),
+      .timestamp = 0x1122334455667788LLU + index};
+
+    records.emplace_back(record);
+
+    AppendElement(serialisedData, record.id, std::endian::big);
+    serialisedData.insert(std::end(serialisedData), std::begin(record.tag),
+                          std::end(record.tag));
+    AppendElement(serialisedData, record.length, std::endian::little);
+    AppendElement(serialisedData, record.timestamp, std::endian::big);
+
+    EXPECT_EQ(encoder.EncodeStr(std::span<WireRecord const>{records}),
+              EncodeBase64Str(std::data(serialisedData),
+                              std::size(serialisedData), 1U))
+      << "Wrong encoded records.";
+  }
+  // NOLINTEND(*-magic-numbers)
+
+  {
+    std::vector<char> encodedData(encoder.GetEncodedCharCount(2U) - 1U);
+
+    EXPECT_EQ(encoder.Encode(std::data(records), 2U, encodedData), false)
+      << "Encoded into a small span.";
+  }
+}
+
+TEST(Base64RecordEncoderTest, RawRecordTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  const std::array<std::uint32_t, 5U> data{1U, 2U, 3U, 4U, 0xFFFFFFFFU};
+
+  const std::array fields{
+    RecordFieldBase64{.offset = 0U,
+                      .primitiveSize = 4U,
+                      .byteOrder = std::endian::native}};
+
+  const RecordEncoder encoder{sizeof(std::uint32_t), fields};
+
+  EXPECT_EQ(encoder.EncodeStr(std::data(data), std::size(data)),
+            EncodeBase64Str(std::data(data), std::size(data), 4U,
+                            std::endian::native))
+    << "Wrong encoded raw records.";
+}
+
+TEST(Base64RecordEncoderTest, InvalidSchemaTest) {
+  const std::array outOfBoundsFields{
+    RecordFieldBase64{.offset = 6U, .primitiveSize = 4U}};
+  const std::array zeroSizeFields{
+    RecordFieldBase64{.offset = 0U, .primitiveSize = 0U}};
+
+  // NOLINTBEGIN(*-magic-numbers)
+  EXPECT_EQ(RecordEncoder(8U, outOfBoundsFields).IsValid(), false)
+    << "A field out of the record was valid.";
+  EXPECT_EQ(RecordEncoder(8U, zeroSizeFields).IsValid(), false)
+    << "A zero primitive size was valid.";
+  EXPECT_EQ(RecordEncoder(8U, {}).EncodeStr(nullptr, 1U), "")
+    << "An empty schema was encoded.";
+  // NOLINTEND(*-magic-numbers)
+}
+
+TEST(Base64RecordEncoderTest, OverflowTest) {
+  // NOLINTBEGIN(*-magic-numbers)
+  // The fields overlap, so 8 bytes are encoded out of a 4 byte record.
+  const std::array fields{RecordFieldBase64{.offset = 0U, .primitiveSize = 4U},
+                          RecordFieldBase64{.offset = 0U, .primitiveSize = 4U}};
+
+  const RecordEncoder encoder{4U, fields};
+
+  const size_t recordCount = std::numeric_limits<size_t>::max() / 4U;
+
+  EXPECT_EQ(encoder.GetEncodedByteCount(), 8U) << "Wrong encoded byte count.";
+  EXPECT_EQ(encoder.GetEncodedCharCount(recordCount), 0U)
+    << "Overflowing character count wasn't 0.";
+  EXPECT_EQ(encoder.Encode(nullptr, recordCount, std::span<char>{}), false)
+    << "Overflowing record count was encoded.";
+  EXPECT_EQ(encoder.EncodeStr(nullptr, recordCount), "")
+    << "Overflowing record count was encoded.";
+  // NOLINTEND(*-magic-numbers)
+}
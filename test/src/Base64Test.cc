@@ -1,7 +1,15 @@
 #include <gtest/gtest.h>
 
 #include <Base64Encoder.hpp>
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
 
 using namespace Phobos;
 
@@ -437,3 +445,527 @@ TEST(Base64Test, EncodeBase64Test4) {
       << "Wrong encoded string.";
   }
 }
+
+TEST(Base64Test, EncodeBase64SpanTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::uint32_t, 2U> data{2U, 3U};
+
+  std::array<char, 12U> encodedData{};
+
+  EXPECT_EQ(EncodeBase64(std::data(data), std::size(data), 4U, encodedData),
+            true)
+    << "Couldn't encode.";
+  EXPECT_EQ(std::string(std::begin(encodedData), std::end(encodedData)),
+            "AAAAAgAAAAM=")
+    << "Wrong encoded string.";
+
+  EXPECT_EQ(EncodeBase64(std::data(data), std::size(data), 4U,
+                         std::span{encodedData}.first(8U)),
+            false)
+    << "Encoded into a smaller output.";
+  EXPECT_EQ(EncodeBase64(std::data(data), 1U, 0U, encodedData), false)
+    << "Encoded a zero primitive size.";
+  EXPECT_EQ(EncodeBase64(std::data(data), 0U, 4U, std::span<char>{}), true)
+    << "Couldn't encode zero elements.";
+}
+
+namespace {
+struct UnsupportedElement {
+  std::uint8_t first;
+  std::uint16_t second;
+};
+
+template <typename T>
+concept TypedEncodable = requires(std::span<T const> data) {
+  { EncodeBase64(data) };
+};
+} // namespace
+
+TEST(Base64Test, EncodeBase64TypedTest) {
+  static_assert(TypedEncodable<std::uint8_t>);
+  static_assert(TypedEncodable<std::uint64_t>);
+  static_assert(TypedEncodable<std::byte>);
+  static_assert(!TypedEncodable<UnsupportedElement>);
+  static_assert(!TypedEncodable<std::array<std::uint8_t, 3U>>);
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::vector<std::uint8_t> data{9U, 7U, 5U, 3U, 1U, 6U, 2U, 4U, 8U, 0U};
+
+    for (size_t count = 0U; count <= std::size(data); ++count) {
+      EXPECT_EQ(EncodeBase64Str(std::span<std::uint8_t const>{std::data(data),
+                                                              count}),
+                EncodeBase64Str(std::data(data), count, 1U))
+        << "Wrong encoded string.";
+    }
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint16_t, 3U> data{2U, 3U, 7U};
+
+    EXPECT_EQ(EncodeBase64Str(data), "AAIAAwAH") << "Wrong encoded string.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint32_t, 1U> data{0xfffff9U};
+
+    const std::vector<char> encodedData = EncodeBase64(data);
+
+    EXPECT_EQ(std::string(std::begin(encodedData), std::end(encodedData)),
+              "AP//+Q==")
+      << "Wrong encoded string.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    const std::vector<std::uint64_t> data{2U, 3U, 7U};
+
+    EXPECT_EQ(EncodeBase64Str(data), "AAAAAAAAAAIAAAAAAAAAAwAAAAAAAAAH")
+      << "Wrong encoded string.";
+  }
+}
+
+TEST(Base64Test, EncodeBase64ByteOrderTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::uint32_t, 5U> data{0xfffff9U, 2U, 3U, 0x12345678U, 7U};
+
+  const std::string rawEncodedData =
+    EncodeBase64Str(std::data(data), sizeof(data), 1U);
+
+  EXPECT_EQ(EncodeBase64Str(std::data(data), std::size(data), 4U,
+                            std::endian::native),
+            rawEncodedData)
+    << "Native order isn't the raw memory.";
+  EXPECT_EQ(EncodeBase64Str<std::endian::native>(data), rawEncodedData)
+    << "Native order isn't the raw memory.";
+  EXPECT_EQ(EncodeBase64Str(std::data(data), std::size(data), 4U,
+                            std::endian::big),
+            EncodeBase64Str(data))
+    << "Big endian isn't the default.";
+
+  if constexpr (std::endian::native == std::endian::little) {
+    EXPECT_EQ(EncodeBase64Str<std::endian::little>(data), rawEncodedData)
+      << "Little endian isn't the raw memory.";
+
+    // Swapping on a little endian host produces big endian.
+    for (size_t count = 0U; count <= std::size(data); ++count) {
+      std::string encodedData(EncodedCharCountBase64(count, 4U), '\0');
+
+      Detail::EncodeSwappedElements<4U>(std::data(data), count,
+                                        std::data(encodedData));
+
+      EXPECT_EQ(encodedData, EncodeBase64Str(std::data(data), count, 4U))
+        << "Wrong swapped encoded string.";
+    }
+  }
+}
+
+TEST(Base64Test, EncodeBase64FlushTest) {
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint32_t, 4U> data{2U, 3U, 7U, 0x12345678U};
+
+    EXPECT_EQ(EncodeBase64Str(std::data(data), std::size(data), 4U),
+              "AAAAAgAAAAMAAAAHEjRWeA==")
+      << "Wrong encoded string.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint32_t, 7U> data{0x01020304U, 0x12131415U, 0x23242526U,
+                                       // NOLINTNEXTLINE(*-magic-numbers)
+                                       0x34353637U, 0x45464748U, 0x56575859U,
+                                       // NOLINTNEXTLINE(*-magic-numbers)
+                                       0x6768696aU};
+
+    EXPECT_EQ(EncodeBase64Str(std::data(data), std::size(data), 4U),
+              "AQIDBBITFBUjJCUmNDU2N0VGR0hWV1hZZ2hpag==")
+      << "Wrong encoded string.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint64_t, 4U> data{2U, 3U, 7U, 0x123456789aLLU};
+
+    EXPECT_EQ(EncodeBase64Str(std::data(data), std::size(data), 8U),
+              "AAAAAAAAAAIAAAAAAAAAAwAAAAAAAAAHAAAAEjRWeJo=")
+      << "Wrong encoded string.";
+  }
+}
+
+TEST(Base64Test, EncodeBase64RepeatedTest) {
+  auto Repeat = [](std::string_view unit, size_t count) {
+    std::string repeatedData{};
+
+    for (size_t index = 0U; index < count; ++index) {
+      repeatedData += unit;
+    }
+
+    return repeatedData;
+  };
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::vector<std::uint8_t> data(100U, 0U);
+
+    EXPECT_EQ(EncodeBase64Str(std::data(data), std::size(data), 1U),
+              Repeat("AAAA", 33U) + "AA==")
+      << "Wrong encoded zeroes.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::vector<std::uint8_t> data(90U);
+
+    for (size_t index = 0U; index < std::size(data); ++index) {
+      data[index] = static_cast<std::uint8_t>("abc"[index % 3U]);
+    }
+
+    EXPECT_EQ(EncodeBase64Str(std::data(data), std::size(data), 1U),
+              Repeat("YWJj", 30U))
+      << "Wrong encoded pattern.";
+  }
+
+  {
+    // A changed byte in the middle of a run.
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::vector<std::uint8_t> data(80U, 0U);
+
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[50U] = 0xffU;
+
+    EXPECT_EQ(EncodeBase64Str(std::data(data), std::size(data), 1U),
+              Repeat("AAAA", 16U) + "AAD/" + Repeat("AAAA", 9U) + "AAA=")
+      << "Wrong encoded string.";
+  }
+}
+
+TEST(Base64Test, EncodeFixedTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::uint8_t, 16U> uuid{0x12U, 0x3eU, 0x45U, 0x67U, 0xe8U, 0x9bU,
+                                     // NOLINTNEXTLINE(*-magic-numbers)
+                                     0x12U, 0xd3U, 0xa4U, 0x56U, 0x42U, 0x66U,
+                                     // NOLINTNEXTLINE(*-magic-numbers)
+                                     0x14U, 0x17U, 0x40U, 0x00U};
+
+  {
+    const auto encodedData = EncodeFixed<16U>(std::data(uuid));
+
+    static_assert(std::size(encodedData) == 24U);
+
+    EXPECT_EQ(std::string_view(std::data(encodedData), std::size(encodedData)),
+              EncodeBase64Str(std::data(uuid), std::size(uuid), 1U))
+      << "Wrong encoded string.";
+  }
+
+  for (size_t count = 0U; count < 3U; ++count) {
+    // Each of the padding cases.
+    const std::string expectedData =
+      EncodeBase64Str(std::data(uuid), 13U + count, 1U);
+
+    std::string encodedData{};
+
+    if (count == 0U) {
+      const auto fixedData = EncodeFixed<13U>(std::data(uuid));
+
+      encodedData.assign(std::begin(fixedData), std::end(fixedData));
+    } else if (count == 1U) {
+      const auto fixedData = EncodeFixed<14U>(std::data(uuid));
+
+      encodedData.assign(std::begin(fixedData), std::end(fixedData));
+    } else {
+      const auto fixedData = EncodeFixed<15U>(std::data(uuid));
+
+      encodedData.assign(std::begin(fixedData), std::end(fixedData));
+    }
+
+    EXPECT_EQ(encodedData, expectedData) << "Wrong padded string.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    const std::array<std::uint64_t, 1U> id{0x123456789aLLU};
+
+    const auto encodedData = EncodeFixed(id);
+
+    EXPECT_EQ(std::string_view(std::data(encodedData), std::size(encodedData)),
+              "AAAAEjRWeJo=")
+      << "Wrong encoded id.";
+
+    const auto littleData = EncodeFixed<std::endian::little>(id);
+
+    EXPECT_EQ(std::string_view(std::data(littleData), std::size(littleData)),
+              EncodeBase64Str(std::data(id), 1U, 8U, std::endian::little))
+      << "Wrong encoded little endian id.";
+  }
+}
+
+TEST(Base64Test, EncodeBase64StreamingTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> data(10000U);
+
+  for (size_t index = 0U; index < std::size(data); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint8_t>(index * 131U + 7U);
+  }
+
+  const size_t streamingThreshold = GetStreamingThresholdBase64();
+
+  for (const size_t primitiveSize : {1U, 2U, 4U, 8U}) {
+    // The big endian elements are swapped while streaming, the little endian
+    // ones are copied.
+    for (const std::endian byteOrder :
+         {std::endian::big, std::endian::little}) {
+      // Crosses the staging chunks, with and without padding.
+      // NOLINTNEXTLINE(*-magic-numbers)
+      for (const size_t byteCount : {8U, 3072U, 3080U, 9992U}) {
+        const size_t elementCount = byteCount / primitiveSize;
+
+        SetStreamingThresholdBase64(0U);
+
+        const std::string expectedData = EncodeBase64Str(
+          std::data(data), elementCount, primitiveSize, byteOrder);
+
+        SetStreamingThresholdBase64(1U);
+
+        // Unaligned output, so the head and the tail of the stores are tested.
+        std::vector<char> encodedData(std::size(expectedData) + 1U, '\0');
+
+        const bool isEncoded = EncodeBase64(
+          std::data(data), elementCount, primitiveSize,
+          std::span<char>{encodedData}.subspan(1U), byteOrder);
+
+        EXPECT_EQ(isEncoded, true) << "Couldn't encode.";
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        EXPECT_EQ(std::string_view(std::data(encodedData) + 1U,
+                                   std::size(expectedData)),
+                  expectedData)
+          << "Wrong streamed string.";
+      }
+    }
+  }
+
+  SetStreamingThresholdBase64(streamingThreshold);
+}
+
+TEST(Base64Test, EncodeBase64WideCharTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> data(200U);
+
+  for (size_t index = 0U; index < std::size(data); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint8_t>(index * 37U + 11U);
+  }
+
+  for (const size_t primitiveSize : {1U, 2U, 4U, 8U}) {
+    for (const std::endian byteOrder :
+         {std::endian::big, std::endian::little}) {
+      // NOLINTNEXTLINE(*-magic-numbers)
+      for (const size_t byteCount : {0U, 8U, 16U, 24U, 56U, 200U}) {
+        const size_t elementCount = byteCount / primitiveSize;
+
+        const std::string expectedData = EncodeBase64Str(
+          std::data(data), elementCount, primitiveSize, byteOrder);
+
+        const std::u8string expectedU8Data(std::begin(expectedData),
+                                           std::end(expectedData));
+        const std::u16string expectedU16Data(std::begin(expectedData),
+                                             std::end(expectedData));
+
+        EXPECT_EQ(EncodeBase64U8Str(std::data(data), elementCount,
+                                    primitiveSize, byteOrder),
+                  expectedU8Data)
+          << "Wrong UTF-8 string.";
+        EXPECT_EQ(EncodeBase64U16Str(std::data(data), elementCount,
+                                     primitiveSize, byteOrder),
+                  expectedU16Data)
+          << "Wrong UTF-16 string.";
+      }
+    }
+  }
+
+  {
+    const std::array<std::uint8_t, 2U> shortData{0xFBU, 0xFFU};
+
+    std::array<char16_t, 4U> encodedData{};
+
+    EXPECT_EQ(EncodeBase64(std::data(shortData), 1U, 2U,
+                           std::span<char16_t>{encodedData}.first(3U)),
+              false)
+      << "Encoded into a small span.";
+    EXPECT_EQ(EncodeBase64(std::data(shortData), 1U, 2U,
+                           std::span<char16_t>{encodedData}),
+              true)
+      << "Couldn't encode into a span.";
+    EXPECT_EQ(std::u16string_view(std::data(encodedData), 4U), u"//s=")
+      << "Wrong UTF-16 span.";
+    EXPECT_EQ(EncodeBase64(std::data(shortData), 1U, 0U,
+                           std::span<char16_t>{encodedData}),
+              false)
+      << "Encoded a zero primitive size.";
+  }
+}
+
+TEST(Base64Test, EncodeBase64AnyWidthTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> data(17U * 20U);
+
+  for (size_t index = 0U; index < std::size(data); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint8_t>(index * 23U + 1U);
+  }
+
+  // NOLINTNEXTLINE(*-magic-numbers)
+  for (const size_t primitiveSize : {3U, 5U, 6U, 7U, 16U, 17U}) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    for (const size_t elementCount : {0U, 1U, 2U, 3U, 20U}) {
+      std::vector<std::uint8_t> swappedData(
+        std::begin(data),
+        std::begin(data) +
+          static_cast<std::ptrdiff_t>(elementCount * primitiveSize));
+
+      for (auto elementBegin = std::begin(swappedData);
+           elementBegin != std::end(swappedData);
+           elementBegin += static_cast<std::ptrdiff_t>(primitiveSize)) {
+        std::reverse(elementBegin, elementBegin + static_cast<std::ptrdiff_t>(
+                                                    primitiveSize));
+      }
+
+      const std::endian otherOrder = std::endian::native == std::endian::little
+                                       ? std::endian::big
+                                       : std::endian::little;
+
+      EXPECT_EQ(
+        EncodeBase64Str(std::data(data), elementCount, primitiveSize,
+                        otherOrder),
+        EncodeBase64Str(std::data(swappedData), std::size(swappedData), 1U))
+        << "Wrong swapped elements.";
+      EXPECT_EQ(EncodeBase64Str(std::data(data), elementCount, primitiveSize,
+                                std::endian::native),
+                EncodeBase64Str(std::data(data), elementCount * primitiveSize,
+                                1U))
+        << "Wrong native elements.";
+      EXPECT_EQ(EncodeBase64U16Str(std::data(data), elementCount,
+                                   primitiveSize, otherOrder),
+                EncodeBase64U16Str(std::data(swappedData),
+                                   std::size(swappedData), 1U))
+        << "Wrong swapped UTF-16 elements.";
+    }
+  }
+
+  EXPECT_EQ(EncodeBase64Str(std::data(data), 1U, 0U), "")
+    << "Encoded a zero primitive size.";
+  EXPECT_EQ(std::empty(EncodeBase64(std::data(data), SIZE_MAX / 2U, 2U)), true)
+    << "Encoded an overflowing byte count.";
+
+#ifdef __SIZEOF_INT128__
+  {
+    const std::array<UInt128Base64_t, 2U> hashes{
+      // NOLINTNEXTLINE(*-magic-numbers)
+      (UInt128Base64_t{0x0011223344556677LLU} << 64U) | 0x8899AABBCCDDEEFFLLU,
+      UInt128Base64_t{1U}};
+
+    std::array<std::uint8_t, 32U> bigEndianData{
+      0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U,
+      0x88U, 0x99U, 0xAAU, 0xBBU, 0xCCU, 0xDDU, 0xEEU, 0xFFU};
+
+    bigEndianData.back() = 1U;
+
+    EXPECT_EQ(EncodeBase64Str(hashes),
+              EncodeBase64Str(std::data(bigEndianData),
+                              std::size(bigEndianData), 1U))
+      << "Wrong encoded 128bits.";
+  }
+#endif
+}
+
+TEST(Base64Test, EncodeBase64AllocatorTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  const std::array<std::uint32_t, 5U> data{1U, 2U, 3U, 0xFFFFU, 0xFFFFFFFFU};
+
+  const std::string expectedData =
+    EncodeBase64Str(std::data(data), std::size(data), 4U);
+
+  // The upstream throws on any allocation, so the output must come from the
+  // arena only.
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::byte, 256U> arenaData{};
+  std::pmr::monotonic_buffer_resource arena{
+    std::data(arenaData), std::size(arenaData),
+    std::pmr::null_memory_resource()};
+
+  const std::pmr::string encodedStr =
+    EncodeBase64Str(std::data(data), std::size(data), 4U, &arena);
+
+  EXPECT_EQ(std::string_view{encodedStr}, expectedData)
+    << "Wrong arena string.";
+
+  const std::pmr::vector<char> encodedData =
+    EncodeBase64(std::data(data), std::size(data), 4U, &arena);
+
+  EXPECT_EQ(std::string_view(std::data(encodedData), std::size(encodedData)),
+            expectedData)
+    << "Wrong arena vector.";
+
+  const auto allocatedData =
+    EncodeBase64Str(std::data(data), std::size(data), 4U,
+                    std::pmr::polymorphic_allocator<char>{&arena},
+                    std::endian::little);
+
+  EXPECT_EQ(std::string_view{allocatedData},
+            EncodeBase64Str(std::data(data), std::size(data), 4U,
+                            std::endian::little))
+    << "Wrong allocator string.";
+
+  EXPECT_EQ(std::empty(EncodeBase64(std::data(data), 1U, 0U, &arena)), true)
+    << "Encoded a zero primitive size.";
+}
+
+TEST(Base64Test, EncodeBase64BlocksTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint8_t> data(8U * 11U);
+
+  for (size_t index = 0U; index < std::size(data); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint8_t>(index * 61U + 3U);
+  }
+
+  for (const size_t primitiveSize : {2U, 4U, 8U}) {
+    for (const std::endian byteOrder :
+         {std::endian::big, std::endian::little}) {
+      // Every remainder of the 3 element blocks.
+      // NOLINTNEXTLINE(*-magic-numbers)
+      for (size_t elementCount = 0U; elementCount <= 11U; ++elementCount) {
+        std::vector<std::uint8_t> orderedData(
+          std::begin(data),
+          std::begin(data) +
+            static_cast<std::ptrdiff_t>(elementCount * primitiveSize));
+
+        if (byteOrder != std::endian::native) {
+          for (auto elementBegin = std::begin(orderedData);
+               elementBegin != std::end(orderedData);
+               elementBegin += static_cast<std::ptrdiff_t>(primitiveSize)) {
+            std::reverse(elementBegin,
+                         elementBegin +
+                           static_cast<std::ptrdiff_t>(primitiveSize));
+          }
+        }
+
+        const std::string expectedData = EncodeBase64Str(
+          std::data(orderedData), std::size(orderedData), 1U);
+
+        EXPECT_EQ(EncodeBase64Str(std::data(data), elementCount,
+                                  primitiveSize, byteOrder),
+                  expectedData)
+          << "Wrong encoded blocks.";
+        EXPECT_EQ(EncodeBase64U8Str(std::data(data), elementCount,
+                                    primitiveSize, byteOrder),
+                  std::u8string(std::begin(expectedData),
+                                std::end(expectedData)))
+          << "Wrong encoded UTF-8 blocks.";
+      }
+    }
+  }
+}
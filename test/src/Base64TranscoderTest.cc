@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <Base64Encoder.hpp>
+#include <Base64Transcoder.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+
+using namespace Phobos;
+
+TEST(Base64TranscoderTest, Base64ToHexTest) {
+  EXPECT_EQ(TranscodeBase64ToHex(""), "") << "Wrong empty hex.";
+  EXPECT_EQ(TranscodeBase64ToHex("AP//+Q=="), "00fffff9") << "Wrong hex.";
+  EXPECT_EQ(TranscodeBase64ToHex("AP//+Q==", true), "00FFFFF9")
+    << "Wrong upper case hex.";
+  EXPECT_EQ(TranscodeBase64ToHex("AgM="), "0203") << "Wrong hex.";
+  EXPECT_EQ(TranscodeBase64ToHex("AgMD"), "020303") << "Wrong hex.";
+
+  EXPECT_EQ(TranscodeBase64ToHex("AgM").has_value(), false)
+    << "Unpadded string was transcoded.";
+  EXPECT_EQ(TranscodeBase64ToHex("A===").has_value(), false)
+    << "Over padded string was transcoded.";
+  EXPECT_EQ(TranscodeBase64ToHex("Ag-_").has_value(), false)
+    << "Url alphabet was transcoded.";
+
+  {
+    std::array<char, 5U> hexData{};
+
+    EXPECT_EQ(TranscodeBase64ToHex("AgMD", hexData), false)
+      << "Small output was written.";
+  }
+}
+
+TEST(Base64TranscoderTest, HexToBase64Test) {
+  EXPECT_EQ(TranscodeHexToBase64(""), "") << "Wrong empty string.";
+  EXPECT_EQ(TranscodeHexToBase64("00fffff9"), "AP//+Q==")
+    << "Wrong encoded string.";
+  EXPECT_EQ(TranscodeHexToBase64("00FFffF9"), "AP//+Q==")
+    << "Mixed case wasn't taken.";
+
+  EXPECT_EQ(TranscodeHexToBase64("0ff").has_value(), false)
+    << "Odd digit count was transcoded.";
+  EXPECT_EQ(TranscodeHexToBase64("0g").has_value(), false)
+    << "Invalid digit was transcoded.";
+  EXPECT_EQ(TranscodeHexToBase64("1234567x").has_value(), false)
+    << "Invalid tail digit was transcoded.";
+}
+
+TEST(Base64TranscoderTest, RoundTripTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::uint8_t, 32U> digest{};
+
+  for (size_t index = 0U; index < std::size(digest); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    digest[index] = static_cast<std::uint8_t>(index * 37U + 11U);
+  }
+
+  std::string expectedHex{};
+
+  for (const std::uint8_t byte : digest) {
+    constexpr std::string_view hexDigits = "0123456789abcdef";
+
+    // NOLINTBEGIN(*-magic-numbers)
+    expectedHex += hexDigits[byte >> 4U];
+    expectedHex += hexDigits[byte & 0xFU];
+    // NOLINTEND(*-magic-numbers)
+  }
+
+  for (size_t count = 0U; count <= std::size(digest); ++count) {
+    const std::string encodedData =
+      EncodeBase64Str(std::data(digest), count, 1U);
+    const std::string hexData = expectedHex.substr(0U, count * 2U);
+
+    EXPECT_EQ(TranscodeBase64ToHex(encodedData), hexData) << "Wrong hex.";
+    EXPECT_EQ(TranscodeHexToBase64(hexData), encodedData)
+      << "Wrong encoded string.";
+  }
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <Base64Encoder.hpp>
+#include <Base64View.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Phobos;
+
+static_assert(std::ranges::random_access_range<Base64View>);
+static_assert(std::ranges::sized_range<Base64View>);
+static_assert(std::ranges::view<Base64View>);
+static_assert(std::ranges::borrowed_range<Base64View>);
+
+TEST(Base64ViewTest, CharactersTest) {
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::array<std::uint8_t, 10U> data{9U, 7U, 5U, 3U, 1U, 6U, 2U, 4U, 8U, 0xffU};
+
+  for (size_t count = 0U; count <= std::size(data); ++count) {
+    const Base64View view{std::data(data), count, 1U};
+
+    EXPECT_EQ(std::size(view), EncodedCharCountBase64(count, 1U))
+      << "Wrong size.";
+    EXPECT_EQ(std::string(std::begin(view), std::end(view)),
+              EncodeBase64Str(std::data(data), count, 1U))
+      << "Wrong characters.";
+  }
+
+  {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    std::array<std::uint32_t, 5U> wideData{0xfffffff9U, 2U, 3U, 0x12345678U,
+                                           7U};
+
+    for (const std::endian byteOrder :
+         {std::endian::big, std::endian::little}) {
+      const Base64View view = viewBase64(wideData, byteOrder);
+
+      EXPECT_EQ(std::string(std::begin(view), std::end(view)),
+                EncodeBase64Str(std::data(wideData), std::size(wideData), 4U,
+                                byteOrder))
+        << "Wrong characters.";
+    }
+
+    const Base64View view = wideData | viewBase64;
+
+    // NOLINTNEXTLINE(*-magic-numbers)
+    EXPECT_EQ(view[5], 'Q') << "Wrong random access.";
+    EXPECT_EQ(*(std::end(view) - 1), '=') << "Wrong random access.";
+  }
+
+  EXPECT_EQ(std::empty(Base64View(std::data(data), 3U, 0U)), true)
+    << "Zero primitive size isn't empty.";
+}
+
+TEST(Base64ViewTest, AnyWidthTest) {
+  // A width which isn't a power of two, and one whose LCM(3, width) block
+  // doesn't fit in a chunk.
+  // NOLINTNEXTLINE(*-magic-numbers)
+  for (const size_t primitiveSize : {3U, 5U, 2048U}) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    const size_t elementCount = primitiveSize < 8U ? 2003U : 3U;
+
+    std::vector<std::uint8_t> data(elementCount * primitiveSize);
+
+    for (size_t index = 0U; index < std::size(data); ++index) {
+      // NOLINTNEXTLINE(*-magic-numbers)
+      data[index] = static_cast<std::uint8_t>(index * 131U + 7U);
+    }
+
+    for (const std::endian byteOrder :
+         {std::endian::big, std::endian::little}) {
+      const Base64View view{std::data(data), elementCount, primitiveSize,
+                            byteOrder};
+
+      const std::string expectedData = EncodeBase64Str(
+        std::data(data), elementCount, primitiveSize, byteOrder);
+
+      EXPECT_EQ(std::string(std::begin(view), std::end(view)), expectedData)
+        << "Wrong characters.";
+
+      std::string encodedData{};
+
+      view.ForEachChunk(
+        [&encodedData](std::string_view chunk) { encodedData += chunk; });
+
+      EXPECT_EQ(encodedData, expectedData) << "Wrong chunked characters.";
+    }
+  }
+}
+
+TEST(Base64ViewTest, IteratorLifetimeTest) {
+  const std::string text = "Hello world";
+
+  Base64View::Iterator iterator{};
+
+  {
+    Base64View view = text | viewBase64;
+
+    iterator = std::begin(view);
+
+    [[maybe_unused]] const Base64View movedView = std::move(view);
+  }
+
+  // NOLINTNEXTLINE(*-magic-numbers)
+  EXPECT_EQ(std::string(iterator, iterator + 16), "SGVsbG8gd29ybGQ=")
+    << "The iterator depends on the view.";
+
+  // A borrowed range, so the iterator of a temporary view doesn't dangle.
+  const auto found = std::ranges::find(text | viewBase64, 'V');
+
+  EXPECT_EQ(*(found + 1), 's') << "Wrong iterator of a temporary view.";
+}
+
+TEST(Base64ViewTest, PipelineTest) {
+  const std::string text = "Hello world";
+
+  auto replacedView = text | viewBase64 | std::views::take(8U) |
+                   std::views::transform([](char character) {
+                     return character == 'G' ? 'g' : character;
+                   });
+
+  EXPECT_EQ(std::string(std::ranges::begin(replacedView),
+                        std::ranges::end(replacedView)),
+            "SgVsbg8g")
+    << "Wrong pipeline output.";
+
+  EXPECT_EQ(std::ranges::equal(text | viewBase64,
+                               std::string_view{"SGVsbG8gd29ybGQ="}),
+            true)
+    << "Wrong comparison.";
+}
+
+TEST(Base64ViewTest, ForEachChunkTest) {
+  // Spans a few chunks and ends with padding.
+  // NOLINTNEXTLINE(*-magic-numbers)
+  std::vector<std::uint16_t> data(5000U);
+
+  for (size_t index = 0U; index < std::size(data); ++index) {
+    // NOLINTNEXTLINE(*-magic-numbers)
+    data[index] = static_cast<std::uint16_t>(index * 40503U);
+  }
+
+  const Base64View view = viewBase64(data);
+
+  std::string encodedData{};
+  size_t chunkCount = 0U;
+
+  view.ForEachChunk([&encodedData, &chunkCount](std::string_view chunk) {
+    encodedData += chunk;
+    ++chunkCount;
+  });
+
+  EXPECT_EQ(chunkCount, 4U) << "Wrong chunk count.";
+  EXPECT_EQ(encodedData,
+            EncodeBase64Str(std::data(data), std::size(data), 2U))
+    << "Wrong chunked characters.";
+  EXPECT_EQ(std::string(std::begin(view), std::end(view)), encodedData)
+    << "Chunks don't match the iterators.";
+}